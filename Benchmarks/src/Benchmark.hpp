@@ -0,0 +1,77 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Headless measurements of engine hot paths. Every benchmark registers itself with TE_REGISTER_BENCHMARK, prints
+// its own table and returns false if one of its checks failed; Main runs the ones named on the command line, or
+// all of them.
+namespace Bench
+{
+using Clock = std::chrono::high_resolution_clock;
+
+struct Benchmark
+{
+    std::string Name;
+    std::string Description;
+    bool (*Run)();
+};
+
+class BenchmarkRegistry
+{
+public:
+    static void Register(const char *name, const char *description, bool (*run)())
+    {
+        Instance().m_Benchmarks.push_back({name, description, run});
+    }
+    static const std::vector<Benchmark> &GetBenchmarks() { return Instance().m_Benchmarks; }
+
+private:
+    static BenchmarkRegistry &Instance()
+    {
+        static BenchmarkRegistry instance;
+        return instance;
+    }
+
+    std::vector<Benchmark> m_Benchmarks;
+};
+
+struct BenchmarkRegisterer
+{
+    BenchmarkRegisterer(const char *name, const char *description, bool (*run)())
+    {
+        BenchmarkRegistry::Register(name, description, run);
+    }
+};
+
+#define TE_REGISTER_BENCHMARK(Name, Description)                                                                       \
+    static bool Name();                                                                                                \
+    static ::Bench::BenchmarkRegisterer Name##_Registerer(#Name, Description, &Name);                                  \
+    static bool Name()
+
+// Fastest of several runs in milliseconds. The first run is a warm-up that also grows pools and scratch buffers,
+// so the result shows the steady state.
+template <typename Func> double BestOfMs(int runs, Func &&func)
+{
+    func();
+    double best = 1e30;
+    for (int run = 0; run < runs; ++run)
+    {
+        auto start = Clock::now();
+        func();
+        best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+// Keeps the optimizer from discarding a result
+template <typename T> void DoNotOptimize(const T &value)
+{
+    static volatile const void *sink;
+    sink = &value;
+    (void)sink;
+}
+
+} // namespace Bench
@@ -0,0 +1,94 @@
+#include "Benchmark.hpp"
+#include "Core/Collision/CollisionSystem.hpp"
+#include "Core/Threading/ThreadingMacros.hpp"
+#include <thread>
+
+using namespace Bench;
+
+// A grid of alternating boxes and circles of unit size, spaced so each one overlaps its right and upper
+// neighbours. CollisionSystem views the CollisionComponent pool itself, so the shapes are set in world space on
+// plain CollisionComponents rather than through the collider subclasses.
+static void BuildColliders(TE::EntityManager &entities, int count)
+{
+    const int columns = 200;
+    for (int i = 0; i < count; ++i)
+    {
+        TE::Entity entity = entities.CreateEntity();
+        auto *collider = entity.AddComponent<TE::CollisionComponent>();
+        TE::TEVector2 center = {0.9f * (float)(i % columns), 0.9f * (float)(i / columns)};
+        if (i % 2 == 0)
+            collider->shape = TE::CollisionShape(TE::BoundsAABB(center - TE::TEVector2(0.5f, 0.5f),
+                                                                center + TE::TEVector2(0.5f, 0.5f)));
+        else
+            collider->shape = TE::CollisionShape(TE::BoundsCircle(center, 0.5f));
+        collider->shape.UpdateVertexCache();
+    }
+}
+
+TE_REGISTER_BENCHMARK(CollisionScaling, "CollisionSystem::Process at 1/2/4/8 threads, 40k colliders (user-014)")
+{
+    const int colliders = 40000;
+    TE::EntityManager entities;
+    BuildColliders(entities, colliders);
+
+    // Seven workers plus this thread, so parallelism 8 has a thread per chunk even where the machine has fewer
+    // cores; on those machines the table shows scheduling overhead rather than speedup
+    JobSystem::Init(7);
+    INIT_CALC_THREAD();
+
+    std::printf("%-8s %10s %10s %10s %10s\n", "threads", "ms/frame", "speedup", "pairs", "contacts");
+    bool passed = true;
+    double serialMs = 0.0;
+    size_t serialContacts = 0;
+    for (size_t threads : {1, 2, 4, 8})
+    {
+        TE::CollisionSystem system(&entities);
+        system.SetParallelism(threads);
+        double ms = BestOfMs(10, [&] { system.Process(); });
+        if (threads == 1)
+        {
+            serialMs = ms;
+            serialContacts = system.GetContacts().size();
+        }
+
+        // Parallel runs must report the same contacts as the serial one
+        passed &= system.GetContacts().size() == serialContacts;
+        std::printf("%-8zu %10.2f %10.2f %10zu %10zu\n", threads, ms, serialMs / ms, system.GetCandidatePairCount(),
+                    system.GetContacts().size());
+    }
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    JobSystem::Shutdown();
+    return passed;
+}
+
+TE_REGISTER_BENCHMARK(BroadPhases, "CollisionSystem::Process with each broad phase, 2k/10k colliders (user-011)")
+{
+    const std::pair<TE::BroadPhaseType, const char *> broadPhases[] = {
+        {TE::BroadPhaseType::BruteForce, "BruteForce"},
+        {TE::BroadPhaseType::SortAndSweep, "SortAndSweep"},
+        {TE::BroadPhaseType::DynamicTree, "DynamicTree"}};
+
+    std::printf("%-10s %-14s %10s %10s %10s\n", "colliders", "broad phase", "ms/frame", "pairs", "contacts");
+    bool passed = true;
+    for (int colliders : {2000, 10000})
+    {
+        TE::EntityManager entities;
+        BuildColliders(entities, colliders);
+
+        // Every broad phase must hand the narrow phase enough pairs to find the same contacts
+        size_t bruteContacts = 0;
+        for (const auto &[type, name] : broadPhases)
+        {
+            TE::CollisionSystem system(&entities);
+            system.SetBroadPhase(type);
+            double ms = BestOfMs(5, [&] { system.Process(); });
+            if (type == TE::BroadPhaseType::BruteForce)
+                bruteContacts = system.GetContacts().size();
+            passed &= system.GetContacts().size() == bruteContacts;
+            std::printf("%-10d %-14s %10.2f %10zu %10zu\n", colliders, name, ms, system.GetCandidatePairCount(),
+                        system.GetContacts().size());
+        }
+    }
+    return passed;
+}
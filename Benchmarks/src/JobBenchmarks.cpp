@@ -0,0 +1,96 @@
+#include "Benchmark.hpp"
+#include "Core/Threading/JobSystem.hpp"
+#include "Core/Threading/ThreadPool.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace Bench;
+
+// Counts every heap allocation in the process, so a benchmark can report allocations per job
+static std::atomic<size_t> s_Allocations{0};
+
+void *operator new(size_t size)
+{
+    s_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+struct Throughput
+{
+    double Ms = 0.0;
+    double AllocationsPerJob = 0.0;
+};
+
+// Best of five runs of jobs empty jobs; Payload is copied into each job's capture to model a small closure
+template <size_t Payload, typename SubmitAll> static Throughput MeasureJobs(int jobs, SubmitAll &&submitAll)
+{
+    Throughput result;
+    result.Ms = BestOfMs(5,
+                         [&]
+                         {
+                             size_t before = s_Allocations.load();
+                             submitAll(jobs);
+                             result.AllocationsPerJob = (double)(s_Allocations.load() - before) / jobs;
+                         });
+    return result;
+}
+
+template <size_t Payload> static Throughput RunThreadPool(ThreadPool &pool, int jobs)
+{
+    return MeasureJobs<Payload>(jobs,
+                                [&pool](int count)
+                                {
+                                    std::atomic<int> done{0};
+                                    char payload[Payload] = {};
+                                    for (int i = 0; i < count; ++i)
+                                        pool.Enqueue([&done, payload] { done.fetch_add(1 + payload[0]); });
+                                    while (done.load() != count)
+                                        std::this_thread::yield();
+                                });
+}
+
+template <size_t Payload> static Throughput RunJobSystem(int jobs)
+{
+    return MeasureJobs<Payload>(jobs,
+                                [](int count)
+                                {
+                                    std::atomic<int> done{0};
+                                    char payload[Payload] = {};
+                                    JobCounter counter;
+                                    for (int i = 0; i < count; ++i)
+                                        JobSystem::Run([&done, payload] { done.fetch_add(1 + payload[0]); },
+                                                       JobPriority::Normal, &counter);
+                                    JobSystem::WaitFor(counter);
+                                });
+}
+
+static void PrintThroughput(const char *path, const char *capture, size_t workers, int jobs, const Throughput &t)
+{
+    std::printf("%-12s %8s %8zu %10.1f %10.2f %12.2f\n", path, capture, workers, t.Ms, jobs / t.Ms / 1000.0,
+                t.AllocationsPerJob);
+}
+
+TE_REGISTER_BENCHMARK(JobThroughput, "1M empty jobs, JobSystem against the old ThreadPool (user-021/022)")
+{
+    const int jobs = 1000000;
+    const size_t workers = std::max<size_t>(1, std::thread::hardware_concurrency() - 1);
+    std::printf("%-12s %8s %8s %10s %10s %12s\n", "scheduler", "capture", "workers", "ms", "Mjobs/s", "allocs/job");
+
+    {
+        ThreadPool pool(workers);
+        PrintThroughput("ThreadPool", "16 B", workers, jobs, RunThreadPool<8>(pool, jobs));
+        PrintThroughput("ThreadPool", "48 B", workers, jobs, RunThreadPool<40>(pool, jobs));
+    }
+
+    JobSystem::Init(workers);
+    PrintThroughput("JobSystem", "16 B", workers, jobs, RunJobSystem<8>(jobs));
+    PrintThroughput("JobSystem", "48 B", workers, jobs, RunJobSystem<40>(jobs));
+    JobSystem::Shutdown();
+    return true;
+}
@@ -0,0 +1,43 @@
+#include "Benchmark.hpp"
+#include "Core/Log.h"
+#include <cstring>
+
+// Usage: Benchmarks [--list] [name...]
+int main(int argc, char **argv)
+{
+    TE::Log::Init(false);
+
+    const auto &benchmarks = Bench::BenchmarkRegistry::GetBenchmarks();
+    if (argc > 1 && std::strcmp(argv[1], "--list") == 0)
+    {
+        for (const Bench::Benchmark &benchmark : benchmarks)
+            std::printf("%-24s %s\n", benchmark.Name.c_str(), benchmark.Description.c_str());
+        return 0;
+    }
+
+    int ran = 0, failed = 0;
+    for (const Bench::Benchmark &benchmark : benchmarks)
+    {
+        bool selected = argc == 1;
+        for (int i = 1; i < argc && !selected; ++i)
+            selected = benchmark.Name == argv[i];
+        if (!selected)
+            continue;
+
+        std::printf("== %s: %s\n", benchmark.Name.c_str(), benchmark.Description.c_str());
+        if (!benchmark.Run())
+        {
+            std::printf("FAILED: %s\n", benchmark.Name.c_str());
+            ++failed;
+        }
+        std::printf("\n");
+        ++ran;
+    }
+
+    if (ran == 0)
+    {
+        std::printf("No benchmark matched; run with --list to see them\n");
+        return 1;
+    }
+    return failed == 0 ? 0 : 1;
+}
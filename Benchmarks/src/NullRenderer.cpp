@@ -0,0 +1,114 @@
+#include "NullRenderer.hpp"
+#include "Renderer/RenderCommand.hpp"
+#include <cstring>
+
+namespace Bench
+{
+
+static NullRenderStats s_Stats;
+
+NullRenderStats &GetNullRenderStats() { return s_Stats; }
+
+void ResetNullRenderStats() { s_Stats = NullRenderStats(); }
+
+void UseNullRenderer() { TE::RenderCommand::SetAPIInstance(std::make_unique<NullRendererAPI>()); }
+
+// ===== NullRendererAPI =====
+
+void NullRendererAPI::DrawIndexed(uint32_t, uint32_t) { s_Stats.DrawCalls++; }
+
+void NullRendererAPI::DrawIndexedInstanced(uint32_t, uint32_t, uint32_t instanceCount)
+{
+    s_Stats.DrawCalls++;
+    s_Stats.Instances += instanceCount;
+}
+
+void NullRendererAPI::SetBlendMode(int) { s_Stats.BlendChanges++; }
+
+void NullRendererAPI::GetViewport(int *viewport)
+{
+    viewport[0] = viewport[1] = 0;
+    viewport[2] = viewport[3] = 1;
+}
+
+void NullRendererAPI::GetClearColor(float *color) { color[0] = color[1] = color[2] = color[3] = 0.0f; }
+
+// ===== NullShader =====
+
+NullShader::NullShader(std::vector<std::string> uniformNames)
+{
+    for (std::string &name : uniformNames)
+        m_Locations.emplace(std::move(name), (int32_t)m_Locations.size());
+    m_Values.resize(m_Locations.size());
+}
+
+void NullShader::Bind() const { s_Stats.ShaderBinds++; }
+
+int32_t NullShader::Lookup(const std::string &name) const
+{
+    s_Stats.NameLookups++;
+    auto it = m_Locations.find(name);
+    return it != m_Locations.end() ? it->second : -1;
+}
+
+void NullShader::Store(TE::UniformHandle handle, const void *value, size_t size)
+{
+    if (!handle.IsValid())
+        return;
+    std::memcpy(&m_Values[handle.Location], value, size);
+    s_Stats.UniformUploads++;
+}
+
+void NullShader::SetUniformMat4(const std::string &name, const glm::mat4 &value)
+{
+    SetUniformMat4(TE::UniformHandle{Lookup(name)}, value);
+}
+void NullShader::SetUniform4f(const std::string &name, const glm::vec4 &value)
+{
+    SetUniform4f(TE::UniformHandle{Lookup(name)}, value);
+}
+void NullShader::SetUniform3f(const std::string &name, const glm::vec3 &value)
+{
+    SetUniform3f(TE::UniformHandle{Lookup(name)}, value);
+}
+void NullShader::SetUniform2f(const std::string &name, const glm::vec2 &value)
+{
+    SetUniform2f(TE::UniformHandle{Lookup(name)}, value);
+}
+void NullShader::SetUniform1f(const std::string &name, float value)
+{
+    SetUniform1f(TE::UniformHandle{Lookup(name)}, value);
+}
+void NullShader::SetUniform1i(const std::string &name, int value)
+{
+    SetUniform1i(TE::UniformHandle{Lookup(name)}, value);
+}
+
+TE::UniformHandle NullShader::GetUniformHandle(const std::string &name) { return TE::UniformHandle{Lookup(name)}; }
+
+void NullShader::SetUniformMat4(TE::UniformHandle handle, const glm::mat4 &value)
+{
+    Store(handle, &value, sizeof(value));
+}
+void NullShader::SetUniform4f(TE::UniformHandle handle, const glm::vec4 &value)
+{
+    Store(handle, &value, sizeof(value));
+}
+void NullShader::SetUniform3f(TE::UniformHandle handle, const glm::vec3 &value)
+{
+    Store(handle, &value, sizeof(value));
+}
+void NullShader::SetUniform2f(TE::UniformHandle handle, const glm::vec2 &value)
+{
+    Store(handle, &value, sizeof(value));
+}
+void NullShader::SetUniform1f(TE::UniformHandle handle, float value) { Store(handle, &value, sizeof(value)); }
+void NullShader::SetUniform1i(TE::UniformHandle handle, int value) { Store(handle, &value, sizeof(value)); }
+
+// ===== Buffers =====
+
+void NullVertexBuffer::SetData(float *, uint32_t size) const { s_Stats.BufferUploadBytes += size; }
+
+void NullVertexArray::Bind() const { s_Stats.VertexArrayBinds++; }
+
+} // namespace Bench
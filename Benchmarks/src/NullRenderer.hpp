@@ -0,0 +1,116 @@
+#pragma once
+#include "Renderer/RendererAPI.hpp"
+#include "Renderer/Shader.hpp"
+#include "Renderer/VertexArray.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A renderer backend that draws nothing and records what it was asked to do, so renderer paths can be measured
+// without a GPU or a window.
+namespace Bench
+{
+
+struct NullRenderStats
+{
+    uint64_t DrawCalls = 0;
+    uint64_t Instances = 0;
+    uint64_t BlendChanges = 0;
+    uint64_t ShaderBinds = 0;
+    uint64_t VertexArrayBinds = 0;
+    uint64_t BufferUploadBytes = 0;
+    uint64_t UniformUploads = 0;
+    uint64_t NameLookups = 0; // Uniform locations resolved from a string, what glGetUniformLocation costs
+};
+
+NullRenderStats &GetNullRenderStats();
+void ResetNullRenderStats();
+
+class NullRendererAPI : public TE::RendererAPI
+{
+public:
+    void Init() override {}
+    void SetViewport(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+    void SetClearColor(const glm::vec4 &) override {}
+    void Clear() override {}
+    void DrawIndexed(uint32_t vao, uint32_t indexCount) override;
+    void DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount) override;
+    void SetBlendMode(int blendMode) override;
+
+    bool LoadLoader(void *(*)(const char *)) override { return true; }
+    std::string GetVersionString() override { return "Null"; }
+    std::string GetGPUVendor() override { return "None"; }
+    std::string GetGPURenderer() override { return "Null"; }
+
+    void GetViewport(int *viewport) override;
+    void GetClearColor(float *color) override;
+    void ReadPixelsRGBA(int, int, int, int, void *) override {}
+    void SetBlendFunc(TE::BlendFactor, TE::BlendFactor) override {}
+    void SetBlendFuncSeparate(TE::BlendFactor, TE::BlendFactor, TE::BlendFactor, TE::BlendFactor) override {}
+};
+
+// Keeps uniform values in a slot table like a GL program. The name-based setters look the name up on every call,
+// as the GL backend did with glGetUniformLocation before handles; the handle setters index the table directly.
+class NullShader : public TE::Shader
+{
+public:
+    explicit NullShader(std::vector<std::string> uniformNames);
+
+    void Bind() const override;
+    void Unbind() const override {}
+
+    void SetUniformMat4(const std::string &name, const glm::mat4 &value) override;
+    void SetUniform4f(const std::string &name, const glm::vec4 &value) override;
+    void SetUniform3f(const std::string &name, const glm::vec3 &value) override;
+    void SetUniform2f(const std::string &name, const glm::vec2 &value) override;
+    void SetUniform1f(const std::string &name, float value) override;
+    void SetUniform1i(const std::string &name, int value) override;
+
+    TE::UniformHandle GetUniformHandle(const std::string &name) override;
+    void SetUniformMat4(TE::UniformHandle handle, const glm::mat4 &value) override;
+    void SetUniform4f(TE::UniformHandle handle, const glm::vec4 &value) override;
+    void SetUniform3f(TE::UniformHandle handle, const glm::vec3 &value) override;
+    void SetUniform2f(TE::UniformHandle handle, const glm::vec2 &value) override;
+    void SetUniform1f(TE::UniformHandle handle, float value) override;
+    void SetUniform1i(TE::UniformHandle handle, int value) override;
+
+private:
+    int32_t Lookup(const std::string &name) const;
+    void Store(TE::UniformHandle handle, const void *value, size_t size);
+
+    std::unordered_map<std::string, int32_t> m_Locations;
+    std::vector<glm::mat4> m_Values; // One slot per uniform, big enough for any type
+};
+
+class NullVertexBuffer : public TE::VertexBuffer
+{
+public:
+    void Bind() const override {}
+    void Unbind() const override {}
+    void SetData(float *vertices, uint32_t size) const override;
+};
+
+class NullVertexArray : public TE::VertexArray
+{
+public:
+    explicit NullVertexArray(uint32_t id) : m_ID(id) {}
+
+    void Bind() const override;
+    void Unbind() const override {}
+    void AddVertexBuffer(TE::VertexBuffer *) override {}
+    void SetIndexBuffer(TE::IndexBuffer *) override {}
+    void AddInstanceBuffer(TE::VertexBuffer *, uint32_t, const std::vector<uint32_t> &) override {}
+    uint32_t GetRendererID() const override { return m_ID; }
+
+private:
+    uint32_t m_ID;
+};
+
+// Installs NullRendererAPI as RenderCommand's backend. RendererContext keeps reporting OpenGL so ShaderLibrary
+// still uploads through the shaders; the benchmarks create every shader and buffer themselves from the classes
+// above instead of through the Create factories.
+void UseNullRenderer();
+
+} // namespace Bench
@@ -0,0 +1,100 @@
+#include "Benchmark.hpp"
+#include "Core/Particle/ParticleSpawner.hpp"
+#include "Core/Particle/ParticleUpdater.hpp"
+#include <cmath>
+#include <random>
+
+using namespace Bench;
+
+// Long-lived particles with random positions and velocities, in both layouts and in the same order
+static void FillParticles(TE::ParticlePool &pool, TE::ParticleBuffer &buffer, size_t count)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+        TE::Particle p;
+        p.Position = {random(rng), random(rng), random(rng)};
+        p.Velocity = {random(rng), random(rng), random(rng)};
+        p.Acceleration = {0.0f, -9.8f, 0.0f};
+        p.Color = {1.0f, 1.0f, 1.0f, 1.0f};
+        p.Lifetime = p.MaxLifetime = 1000.0f + random(rng);
+        p.Active = true;
+        pool.Particles[i] = p;
+        buffer.Spawn(p);
+    }
+}
+
+static float MaxDifference(const TE::ParticlePool &pool, const TE::ParticleBuffer &buffer)
+{
+    float difference = 0.0f;
+    for (size_t i = 0; i < buffer.Count; ++i)
+    {
+        TE::Particle soa = buffer.Get(i);
+        const TE::Particle &aos = pool.Particles[i];
+        difference = std::max({difference, std::abs(soa.Position.y - aos.Position.y),
+                               std::abs(soa.Velocity.y - aos.Velocity.y), std::abs(soa.Color.w - aos.Color.w),
+                               std::abs(soa.Lifetime - aos.Lifetime)});
+    }
+    return difference;
+}
+
+TE_REGISTER_BENCHMARK(ParticleLayouts, "ParticleUpdater on AoS ParticlePool vs SoA ParticleBuffer, 100k/1M (user-025)")
+{
+#if defined(TE_PARTICLE_AVX)
+    const char *kernel = "AVX";
+#elif defined(TE_PARTICLE_SSE)
+    const char *kernel = "SSE2";
+#else
+    const char *kernel = "scalar";
+#endif
+    std::printf("SoA kernel: %s\n", kernel);
+    std::printf("%-10s %-10s %10s %10s %10s %12s\n", "particles", "alive", "AoS ms", "SoA ms", "speedup", "max diff");
+
+    const float dt = 1.0f / 60.0f;
+    bool passed = true;
+    for (size_t count : {(size_t)100000, (size_t)1000000})
+    {
+        TE::ParticlePool pool(count);
+        TE::ParticleBuffer buffer(count);
+        FillParticles(pool, buffer, count);
+        TE::ParticleUpdater aosUpdater, soaUpdater;
+
+        // Timed frames keep stepping the same particles; both layouts get the same number of updates
+        double aosMs = BestOfMs(20, [&] { aosUpdater.Update(pool, dt); });
+        double soaMs = BestOfMs(20, [&] { soaUpdater.Update(buffer, dt); });
+        float difference = MaxDifference(pool, buffer);
+        passed &= difference == 0.0f;
+        std::printf("%-10zu %-10s %10.3f %10.3f %10.2f %12g\n", count, "all", aosMs, soaMs, aosMs / soaMs, difference);
+
+        // Half of them die: the pool keeps scanning every slot, the buffer only visits the live ones
+        TE::ParticleBuffer half(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i % 2 == 0)
+                pool.Particles[i].Lifetime = 0.001f;
+            half.Spawn(pool.Particles[i]);
+        }
+        aosUpdater.Update(pool, dt);
+        soaUpdater.Update(half, dt);
+        aosMs = BestOfMs(20, [&] { aosUpdater.Update(pool, dt); });
+        soaMs = BestOfMs(20, [&] { soaUpdater.Update(half, dt); });
+        std::printf("%-10zu %-10s %10.3f %10.3f %10.2f %12s\n", count, "half", aosMs, soaMs, aosMs / soaMs, "-");
+    }
+
+    // Emitters without a Pool spawn into the buffer they own and die out through the same update
+    TE::ParticleEmitterComponent emitter;
+    emitter.EmitRate = 1000.0f;
+    emitter.ParticleLife = 0.05f;
+    emitter.MaxParticles = 100;
+    TE::ParticleSpawner spawner;
+    TE::ParticleUpdater updater;
+    spawner.Emit(emitter, 0.037f);
+    size_t emitted = emitter.Buffer ? emitter.Buffer->Count : 0;
+    for (int frame = 0; frame < 3; ++frame)
+        updater.Update(emitter, 0.02f);
+    bool emitterOk = emitted == 37 && emitter.Buffer->Count == 0;
+    std::printf("\nemitter owned buffer: emitted %zu, alive after 0.06 s %zu -> %s\n", emitted,
+                emitter.Buffer ? emitter.Buffer->Count : 0, emitterOk ? "ok" : "FAILED");
+    return passed && emitterOk;
+}
@@ -0,0 +1,60 @@
+#include "Benchmark.hpp"
+#include "Core/Physics/PhysicsWorld.hpp"
+#include <memory>
+
+using namespace Bench;
+
+// The editor's test scene widened to a row of boxes: a static ground and boxes falling onto it
+static void BuildScene(TE::PhysicsWorld &world, std::vector<std::unique_ptr<TE::RigidBody>> &bodies, int boxes)
+{
+    auto ground = std::make_unique<TE::RigidBody>();
+    ground->Position = {0.0f, -500.0f};
+    ground->IsStatic = true;
+    ground->Shape = TE::CollisionShape(TE::BoundsAABB({-2000.0f, -50.0f}, {2000.0f, 50.0f}));
+    world.AddBody(ground.get());
+    bodies.push_back(std::move(ground));
+
+    for (int i = 0; i < boxes; ++i)
+    {
+        auto box = std::make_unique<TE::RigidBody>();
+        box->Position = {-1900.0f + 60.0f * (float)(i % 64), 200.0f + 60.0f * (float)(i / 64)};
+        box->Mass = 5.0f;
+        box->Shape = TE::CollisionShape(TE::BoundsAABB({-25.0f, -25.0f}, {25.0f, 25.0f}));
+        world.AddBody(box.get());
+        bodies.push_back(std::move(box));
+    }
+}
+
+TE_REGISTER_BENCHMARK(PhysicsRestore, "Restore + N steps against the live N steps, and snapshot cost (user-018/019)")
+{
+    const int steps = 120;
+    bool passed = true;
+    std::printf("%-32s %8s %8s %10s\n", "case", "bodies", "steps", "result");
+
+    // Bodies outlive the world, which unhooks them on destruction
+    std::vector<std::unique_ptr<TE::RigidBody>> bodies;
+    TE::PhysicsWorld world;
+    BuildScene(world, bodies, 256);
+
+    // Nothing warm-started yet, so the restored runs must match the live one exactly
+    bool fresh = world.VerifyRestore(steps, true);
+    std::printf("%-32s %8zu %8d %10s\n", "fresh world, restore == live", bodies.size(), steps, fresh ? "ok" : "FAILED");
+    passed &= fresh;
+
+    // Boxes resting on the ground: only restores of one snapshot have to agree, the live run may drift
+    for (int i = 0; i < steps; ++i)
+        world.Step(world.GetFixedDeltaTime());
+    bool settled = world.VerifyRestore(steps);
+    std::printf("%-32s %8zu %8d %10s\n", "in contact, restore == restore", bodies.size(), steps,
+                settled ? "ok" : "FAILED");
+    passed &= settled;
+
+    std::vector<uint8_t> snapshot;
+    world.CaptureState(snapshot);
+    double captureMs = BestOfMs(20, [&] { world.CaptureState(snapshot); });
+    double restoreMs = BestOfMs(20, [&] { world.RestoreState(snapshot); });
+    std::printf("\n%-32s %10s %10s\n", "snapshot call", "ms", "bytes");
+    std::printf("%-32s %10.3f %10zu\n", "CaptureState", captureMs, snapshot.size());
+    std::printf("%-32s %10.3f %10zu\n", "RestoreState", restoreMs, snapshot.size());
+    return passed;
+}
@@ -0,0 +1,123 @@
+#include "Benchmark.hpp"
+#include "NullRenderer.hpp"
+#include "Renderer/Material.hpp"
+#include "Renderer/RenderBatcher.hpp"
+#include "Renderer/TEColor.hpp"
+
+using namespace Bench;
+
+static const std::vector<std::string> s_QuadUniforms = {"u_Transform",        "u_ViewProjection", "u_Color",
+                                                        "u_AmbientIntensity", "u_AmbientSky",     "u_AmbientGround"};
+
+TE_REGISTER_BENCHMARK(UniformUploads, "Name-based vs handle-based uniform uploads (user-002)")
+{
+    UseNullRenderer();
+    NullShader shader(s_QuadUniforms);
+    const int uploads = 1000000;
+    glm::mat4 transform(1.0f);
+
+    // What every SetUniform did before handles: resolve the location from the name, then upload
+    ResetNullRenderStats();
+    double nameMs = BestOfMs(5,
+                             [&]
+                             {
+                                 for (int i = 0; i < uploads; ++i)
+                                 {
+                                     transform[3][0] = (float)i;
+                                     shader.SetUniformMat4("u_Transform", transform);
+                                 }
+                             });
+    double nameLookups = (double)GetNullRenderStats().NameLookups / (6.0 * uploads);
+
+    TE::UniformHandle handle = shader.GetUniformHandle("u_Transform");
+    ResetNullRenderStats();
+    double handleMs = BestOfMs(5,
+                               [&]
+                               {
+                                   for (int i = 0; i < uploads; ++i)
+                                   {
+                                       transform[3][0] = (float)i;
+                                       shader.SetUniformMat4(handle, transform);
+                                   }
+                               });
+    double handleLookups = (double)GetNullRenderStats().NameLookups / (6.0 * uploads);
+
+    std::printf("%-28s %10s %14s %16s\n", "path", "ms/1M", "Muploads/s", "lookups/upload");
+    std::printf("%-28s %10.2f %14.1f %16.2f\n", "SetUniformMat4(name)", nameMs, uploads / nameMs / 1000.0, nameLookups);
+    std::printf("%-28s %10.2f %14.1f %16.2f\n", "SetUniformMat4(handle)", handleMs, uploads / handleMs / 1000.0,
+                handleLookups);
+
+    // Material::ApplyUniforms resolves its names once per program, then uploads by handle
+    auto shared = std::make_shared<NullShader>(s_QuadUniforms);
+    TE::Material material(shared);
+    material.SetUniform("u_AmbientIntensity", 0.5f);
+    material.SetUniform("u_AmbientSky", glm::vec3(0.4f, 0.5f, 0.7f));
+    material.SetUniform("u_AmbientGround", glm::vec3(0.2f, 0.2f, 0.2f));
+    const int applies = 200000;
+    ResetNullRenderStats();
+    double applyMs = BestOfMs(5,
+                              [&]
+                              {
+                                  for (int i = 0; i < applies; ++i)
+                                      material.ApplyUniforms();
+                              });
+    const NullRenderStats &stats = GetNullRenderStats();
+    double perApply = (double)stats.UniformUploads / (6.0 * applies);
+    std::printf("%-28s %10.2f %14.1f %16.2f   (%.0f uploads per apply)\n", "Material::ApplyUniforms",
+                applyMs * uploads / (applies * perApply), applies * perApply / applyMs / 1000.0,
+                (double)stats.NameLookups / (double)stats.UniformUploads, perApply);
+    return true;
+}
+
+// One frame of quads across several color materials of one program
+static void SubmitQuads(TE::RenderBatcher &batcher, const std::vector<std::shared_ptr<TE::Material>> &materials,
+                        int quads)
+{
+    batcher.Begin();
+    for (int i = 0; i < quads; ++i)
+    {
+        glm::mat4 transform(1.0f);
+        transform[3][0] = (float)(i % 200);
+        transform[3][1] = (float)(i / 200);
+        const auto &material = materials[i % materials.size()];
+        batcher.SubmitQuad(material, transform, glm::vec4(1.0f, (float)(i % 7) / 7.0f, 0.5f, 1.0f));
+    }
+    batcher.End();
+    batcher.Flush();
+}
+
+TE_REGISTER_BENCHMARK(BatcherFlush, "RenderBatcher flush of 20k quads, instanced vs one draw per quad (user-001/002)")
+{
+    UseNullRenderer();
+    const int quads = 20000;
+
+    auto instanced = std::make_shared<NullShader>(std::vector<std::string>{"u_ViewProjection", "u_Textures"});
+    auto perDraw = std::make_shared<NullShader>(s_QuadUniforms);
+    auto batched = std::make_shared<NullShader>(s_QuadUniforms);
+    batched->SetInstancedVariant(instanced);
+
+    std::printf("%-24s %10s %10s %12s %14s %12s\n", "path", "ms/frame", "draws", "uploads", "name lookups",
+                "blend sets");
+    for (const auto &shader : {perDraw, batched})
+    {
+        // Eight materials that differ only in color, as BoxComponents do
+        std::vector<std::shared_ptr<TE::Material>> materials;
+        for (int m = 0; m < 8; ++m)
+        {
+            materials.push_back(std::make_shared<TE::Material>(shader));
+            materials.back()->SetColor(TE::TEColor(m / 8.0f, 0.5f, 0.5f, 1.0f));
+        }
+
+        TE::RenderBatcher batcher;
+        batcher.Init(std::make_shared<NullVertexArray>(1), std::make_unique<NullVertexBuffer>());
+        double ms = BestOfMs(10, [&] { SubmitQuads(batcher, materials, quads); });
+
+        ResetNullRenderStats();
+        SubmitQuads(batcher, materials, quads);
+        const NullRenderStats &stats = GetNullRenderStats();
+        std::printf("%-24s %10.2f %10llu %12llu %14llu %12llu\n", shader == perDraw ? "one draw per quad" : "instanced",
+                    ms, (unsigned long long)stats.DrawCalls, (unsigned long long)stats.UniformUploads,
+                    (unsigned long long)stats.NameLookups, (unsigned long long)stats.BlendChanges);
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+#include "Core/Scene/EntityManager.hpp"
+
+using namespace Bench;
+
+namespace
+{
+struct PositionComponent : public TE::TComponent
+{
+    TE::TEVector2 Position;
+};
+
+struct VelocityComponent : public TE::TComponent
+{
+    TE::TEVector2 Velocity = {1.0f, 0.5f};
+};
+} // namespace
+
+TE_REGISTER_BENCHMARK(ComponentIteration, "Per-entity lookups vs View vs Query over 100k entities (user-007)")
+{
+    const int count = 100000;
+    TE::EntityManager entities;
+    for (int i = 0; i < count; ++i)
+    {
+        TE::Entity entity = entities.CreateEntity();
+        entity.AddComponent<PositionComponent>();
+        if (i % 2 == 0)
+            entity.AddComponent<VelocityComponent>();
+    }
+
+    // Each path integrates the moving half once per run; the visit counts must agree
+    const float dt = 1.0f / 60.0f;
+    size_t lookupVisits = 0, viewVisits = 0, queryVisits = 0;
+    double lookupMs = BestOfMs(10,
+                               [&]
+                               {
+                                   lookupVisits = 0;
+                                   for (TE::EntityID id : entities.GetAliveEntities())
+                                   {
+                                       auto *velocity = entities.GetComponent<VelocityComponent>(id);
+                                       auto *position = entities.GetComponent<PositionComponent>(id);
+                                       if (!velocity || !position)
+                                           continue;
+                                       position->Position += velocity->Velocity * dt;
+                                       ++lookupVisits;
+                                   }
+                               });
+
+    auto view = entities.View<PositionComponent, VelocityComponent>();
+    double viewMs = BestOfMs(10,
+                             [&]
+                             {
+                                 viewVisits = 0;
+                                 view.Each(
+                                     [&](TE::EntityID, PositionComponent &position, VelocityComponent &velocity)
+                                     {
+                                         position.Position += velocity.Velocity * dt;
+                                         ++viewVisits;
+                                     });
+                             });
+
+    auto query = entities.Query<PositionComponent, VelocityComponent>();
+    double queryMs = BestOfMs(10,
+                              [&]
+                              {
+                                  queryVisits = 0;
+                                  query.Each(
+                                      [&](TE::EntityID, PositionComponent &position, VelocityComponent &velocity)
+                                      {
+                                          position.Position += velocity.Velocity * dt;
+                                          ++queryVisits;
+                                      });
+                              });
+
+    std::printf("%-28s %10s %10s %14s\n", "path", "ms", "visited", "ns/entity");
+    std::printf("%-28s %10.3f %10zu %14.1f\n", "GetComponent per entity", lookupMs, lookupVisits,
+                lookupMs * 1e6 / count);
+    std::printf("%-28s %10.3f %10zu %14.1f\n", "View<Position, Velocity>", viewMs, viewVisits, viewMs * 1e6 / count);
+    std::printf("%-28s %10.3f %10zu %14.1f\n", "Query<Position, Velocity>", queryMs, queryVisits,
+                queryMs * 1e6 / count);
+    return lookupVisits == (size_t)count / 2 && viewVisits == lookupVisits && queryVisits == lookupVisits;
+}
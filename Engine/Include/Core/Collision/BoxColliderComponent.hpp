@@ -24,6 +24,7 @@ public:
                               Size.y * 0.5f * TEVector::Length(TEVector(worldTransform[1]))};
         shape.aabb.min = {pos.x - halfSize.x, pos.y - halfSize.y};
         shape.aabb.max = {pos.x + halfSize.x, pos.y + halfSize.y};
+        shape.UpdateVertexCache();
     }
 };
 
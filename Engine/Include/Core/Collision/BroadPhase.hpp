@@ -12,10 +12,33 @@ struct CollisionPair
     EntityID a, b;
 };
 
+// Candidate pair as indices into the collider list handed to the broad phase, with a < b
+struct ColliderPair
+{
+    uint32_t a, b;
+};
+
+enum class BroadPhaseType : uint8_t
+{
+    BruteForce = 0,   // Every pair, O(n^2)
+    SortAndSweep = 1, // Sort bounds along x and sweep, rebuilt every frame
+    DynamicTree = 2   // Incremental DynamicAABBTree with fattened bounds
+};
+
 class BroadPhase
 {
 public:
     static std::vector<CollisionPair> BruteForce(const std::vector<CollisionComponent *> &colliders);
+
+    // Index-pair variants; outPairs is cleared and only pairs whose bounds overlap are appended
+    static void BruteForce(const std::vector<BoundsAABB> &bounds, std::vector<ColliderPair> &outPairs);
+    static void SortAndSweep(const std::vector<BoundsAABB> &bounds, std::vector<ColliderPair> &outPairs,
+                             std::vector<uint32_t> &scratchOrder);
+
+    static bool Overlaps(const BoundsAABB &a, const BoundsAABB &b)
+    {
+        return !(a.max.x < b.min.x || a.min.x > b.max.x || a.max.y < b.min.y || a.min.y > b.max.y);
+    }
 };
 
 } // namespace TE
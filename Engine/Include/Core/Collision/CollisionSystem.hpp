@@ -1,36 +1,127 @@
 #pragma once
 #include "BroadPhase.hpp"
 #include "CollisionComponent.hpp"
+#include "DynamicAABBTree.hpp"
 #include "Core/Scene/EntityManager.hpp"
+#include "Core/Scene/TransformSystem.hpp"
+#include "Core/Threading/TaskSystem.hpp"
 #include <functional>
 #include <unordered_map>
 
 namespace TE
 {
 
-class CollisionSystem
+struct CollisionContact
+{
+    EntityID a, b;
+    CollisionComponent *colliderA, *colliderB;
+    ContactManifold manifold; // Normal points from colliderA to colliderB
+};
+
+// Entity pair whose colliders touch; a < b and the normal points from a to b
+struct CollisionEvent
+{
+    EntityID a, b;
+    ContactManifold manifold; // Deepest contact between the two entities' colliders this step
+};
+
+class TE_API CollisionSystem
 {
 public:
     CollisionSystem(EntityManager *mgr) : m_EntityManager(mgr) {}
 
     void Process(); // Run every frame
 
+    // Optional; when set, collider shapes are built from its cached world matrices
+    void SetTransformSystem(TransformSystem *transforms) { m_TransformSystem = transforms; }
+
+    void SetBroadPhase(BroadPhaseType type) { m_BroadPhaseType = type; }
+    BroadPhaseType GetBroadPhase() const { return m_BroadPhaseType; }
+
+    // Threads used for shape updates and the narrow phase: 1 (default) runs serially, 0 uses every worker of
+    // the pool plus the calling thread. Results and callback order are identical to a serial run.
+    void SetParallelism(size_t threads, TaskType pool = TaskType::CALC)
+    {
+        m_Parallelism = threads;
+        m_TaskPool = pool;
+    }
+    size_t GetParallelism() const { return m_Parallelism; }
+
+    // Candidate pairs the broad phase handed to the narrow phase during the last Process call
+    size_t GetCandidatePairCount() const { return m_CandidatePairs.size(); }
+
+    // Narrow phase on the cached world-space shapes; fills the manifold when the colliders overlap
+    static bool CheckCollision(const CollisionComponent *a, const CollisionComponent *b, ContactManifold &manifold);
+
+    // Touching collider pairs found by the last Process call
+    const std::vector<CollisionContact> &GetContacts() const { return m_Contacts; }
+
+    // Pair events of the last Process call. Begin and Stay carry this step's manifold, End the last one seen.
+    const std::vector<CollisionEvent> &GetCollisionBeginEvents() const { return m_BeginEvents; }
+    const std::vector<CollisionEvent> &GetCollisionStayEvents() const { return m_StayEvents; }
+    const std::vector<CollisionEvent> &GetCollisionEndEvents() const { return m_EndEvents; }
+
+    // Batched listeners, each invoked at most once per Process call with every event of its kind
+    std::function<void(const std::vector<CollisionEvent> &)> OnCollisionBegin;
+    std::function<void(const std::vector<CollisionEvent> &)> OnCollisionStay;
+    std::function<void(const std::vector<CollisionEvent> &)> OnCollisionEnd;
+
+    // Per collider pair, every step they overlap
     std::function<void(EntityID, EntityID)> onCollision;
 
 private:
+    struct ColliderProxy
+    {
+        int32_t Proxy;
+        uint64_t LastFrame;
+    };
+
+    struct CachedPair
+    {
+        CollisionEvent Event;
+        uint64_t FirstFrame;
+        uint64_t LastFrame;
+    };
+
+    struct EntityPairHash
+    {
+        size_t operator()(const std::pair<EntityID, EntityID> &pair) const
+        {
+            return std::hash<EntityID>()(pair.first * 0x9E3779B97F4A7C15ull ^ pair.second);
+        }
+    };
+
     EntityManager *m_EntityManager;
+    TransformSystem *m_TransformSystem = nullptr;
+
+    size_t m_Parallelism = 1;
+    TaskType m_TaskPool = TaskType::CALC;
+
+    BroadPhaseType m_BroadPhaseType = BroadPhaseType::DynamicTree;
+    DynamicAABBTree m_Tree;
+    std::unordered_map<CollisionComponent *, ColliderProxy> m_Proxies;
+    uint64_t m_Frame = 0;
 
-    // SAT Collision Tests
-    bool CheckCollision(CollisionComponent *a, CollisionComponent *b);
+    // Per-frame scratch, reused to avoid reallocating
+    std::vector<CollisionComponent *> m_Colliders;
+    std::vector<EntityID> m_ColliderOwners;
+    std::vector<BoundsAABB> m_Bounds;
+    std::vector<ColliderPair> m_CandidatePairs;
+    std::vector<uint32_t> m_SweepOrder;
+    std::vector<CollisionContact> m_Contacts;
+    std::vector<std::vector<CollisionContact>> m_ChunkContacts; // Per narrow-phase chunk, merged in chunk order
 
-    bool AABBvsAABB(const BoundsAABB &a, const BoundsAABB &b);
-    bool CircleVsCircle(const BoundsCircle &a, const BoundsCircle &b);
-    bool PolyVsPoly(const std::vector<TEVector2> &a, const std::vector<TEVector2> &b);
-    bool CircleVsPoly(const BoundsCircle &circle, const std::vector<TEVector2> &poly);
+    // Entity pairs touching as of the last step, densely packed and swap-removed when they separate
+    std::vector<CachedPair> m_Pairs;
+    std::unordered_map<std::pair<EntityID, EntityID>, uint32_t, EntityPairHash> m_PairIndex;
+    std::vector<CollisionEvent> m_BeginEvents;
+    std::vector<CollisionEvent> m_StayEvents;
+    std::vector<CollisionEvent> m_EndEvents;
 
-    // Helper for SAT
-    std::vector<TEVector2> GetAxes(const std::vector<TEVector2> &points);
-    void Project(const std::vector<TEVector2> &points, const TEVector2 &axis, float &min, float &max);
+    void UpdateShapes(size_t begin, size_t end);
+    void TestPairs(size_t begin, size_t end, std::vector<CollisionContact> &outContacts) const;
+    void FindCandidatePairs();
+    void UpdatePairCache();
 };
 
 } // namespace TE
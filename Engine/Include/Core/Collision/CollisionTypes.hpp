@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Utils/MathUtils.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <vector>
@@ -70,11 +71,103 @@ struct CollisionShape
     BoundsTriangle triangle;
     BoundsPolygon polygon;
 
+    // World-space outline of the AABB, triangle or polygon in counter-clockwise order, with one outward unit
+    // normal per edge (vertices[i] -> vertices[i + 1]). Rebuilt by UpdateVertexCache, empty for circles.
+    std::vector<TEVector2> vertices;
+    std::vector<TEVector2> normals;
+
     CollisionShape() : type(CollisionType::AABB) {}
     CollisionShape(const BoundsAABB &b) : type(CollisionType::AABB), aabb(b) {}
     CollisionShape(const BoundsCircle &c) : type(CollisionType::Circle), circle(c) {}
     CollisionShape(const BoundsTriangle &t) : type(CollisionType::Triangle), triangle(t) {}
     CollisionShape(const BoundsPolygon &p) : type(CollisionType::Polygon), polygon(p) {}
+
+    // Call after the world-space bounds change; reuses the existing capacity
+    void UpdateVertexCache()
+    {
+        vertices.clear();
+        normals.clear();
+        switch (type)
+        {
+        case CollisionType::AABB:
+            vertices.push_back(aabb.min);
+            vertices.push_back({aabb.max.x, aabb.min.y});
+            vertices.push_back(aabb.max);
+            vertices.push_back({aabb.min.x, aabb.max.y});
+            break;
+        case CollisionType::Triangle:
+            vertices.assign(triangle.points, triangle.points + 3);
+            break;
+        case CollisionType::Polygon:
+            vertices.assign(polygon.points.begin(), polygon.points.end());
+            break;
+        default:
+            return;
+        }
+
+        // Repeated points would produce zero-length edges without a normal
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        while (vertices.size() > 1 && vertices.back() == vertices.front())
+            vertices.pop_back();
+
+        // Mirrored transforms and clockwise authored outlines flip the winding
+        float area = 0.0f;
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            const TEVector2 &a = vertices[i];
+            const TEVector2 &b = vertices[(i + 1) % vertices.size()];
+            area += a.x * b.y - a.y * b.x;
+        }
+        if (area < 0.0f)
+            std::reverse(vertices.begin(), vertices.end());
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            TEVector2 edge = vertices[(i + 1) % vertices.size()] - vertices[i];
+            normals.push_back(TEVector2(edge.y, -edge.x).Normalized());
+        }
+    }
 };
 
+// Result of a narrow-phase test. The normal points from the first shape towards the second.
+struct ContactManifold
+{
+    TEVector2 normal;
+    float depth = 0.0f;
+    TEVector2 points[2];
+    uint8_t pointCount = 0;
+};
+
+// World-space bounding box of a shape, used by the broad phase
+inline BoundsAABB GetShapeBounds(const CollisionShape &shape)
+{
+    switch (shape.type)
+    {
+    case CollisionType::Circle:
+        return {{shape.circle.center.x - shape.circle.radius, shape.circle.center.y - shape.circle.radius},
+                {shape.circle.center.x + shape.circle.radius, shape.circle.center.y + shape.circle.radius}};
+    case CollisionType::Triangle:
+    case CollisionType::Polygon:
+    {
+        const TEVector2 *points = shape.type == CollisionType::Triangle ? shape.triangle.points
+                                                                         : shape.polygon.points.data();
+        size_t count = shape.type == CollisionType::Triangle ? 3 : shape.polygon.points.size();
+        if (count == 0)
+            return {};
+
+        BoundsAABB bounds(points[0], points[0]);
+        for (size_t i = 1; i < count; ++i)
+        {
+            bounds.min.x = points[i].x < bounds.min.x ? points[i].x : bounds.min.x;
+            bounds.min.y = points[i].y < bounds.min.y ? points[i].y : bounds.min.y;
+            bounds.max.x = points[i].x > bounds.max.x ? points[i].x : bounds.max.x;
+            bounds.max.y = points[i].y > bounds.max.y ? points[i].y : bounds.max.y;
+        }
+        return bounds;
+    }
+    default:
+        return shape.aabb;
+    }
+}
+
 } // namespace TE
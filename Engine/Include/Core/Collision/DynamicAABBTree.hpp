@@ -0,0 +1,175 @@
+#pragma once
+#include "CollisionTypes.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace TE
+{
+
+// Incremental bounding volume hierarchy over fattened AABBs. A proxy keeps its fat bounds until the tight
+// bounds leave them, so slow-moving colliders are not reinserted every frame. Insertion picks the sibling
+// with the cheapest perimeter growth and AVL-style rotations keep the tree balanced.
+class DynamicAABBTree
+{
+public:
+    static constexpr int32_t NullNode = -1;
+
+    explicit DynamicAABBTree(float margin = 0.1f) : m_Margin(margin) {}
+
+    int32_t CreateProxy(const BoundsAABB &aabb, uint32_t userData);
+    void DestroyProxy(int32_t proxy);
+    // Returns true when the proxy had to be reinserted because the bounds left its fat AABB
+    bool MoveProxy(int32_t proxy, const BoundsAABB &aabb);
+
+    void SetUserData(int32_t proxy, uint32_t userData) { m_Nodes[proxy].userData = userData; }
+    uint32_t GetUserData(int32_t proxy) const { return m_Nodes[proxy].userData; }
+    const BoundsAABB &GetFatAABB(int32_t proxy) const { return m_Nodes[proxy].aabb; }
+    int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].height; }
+
+    // Calls callback(proxy) for every leaf whose fat AABB overlaps aabb; returning false stops the query
+    template <typename Callback> void Query(const BoundsAABB &aabb, Callback &&callback) const;
+
+    // Walks the leaves whose fat AABB, grown by radius, the segment origin + direction * [0, maxDistance] crosses.
+    // callback(proxy, maxDistance) returns the new maximum distance, which clips the rest of the traversal (return
+    // the value it was given to continue unchanged, 0 to stop). stack is caller-owned scratch, so concurrent casts
+    // are safe.
+    template <typename Callback>
+    void RayCast(const TEVector2 &origin, const TEVector2 &direction, float maxDistance, float radius,
+                 std::vector<int32_t> &stack, Callback &&callback) const;
+
+private:
+    struct TreeNode
+    {
+        BoundsAABB aabb;
+        uint32_t userData = 0;
+        int32_t parent = NullNode; // Doubles as the next link while on the free list
+        int32_t child1 = NullNode;
+        int32_t child2 = NullNode;
+        int32_t height = -1; // Leaf = 0, free = -1
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    static bool Overlaps(const BoundsAABB &a, const BoundsAABB &b)
+    {
+        return !(a.max.x < b.min.x || a.min.x > b.max.x || a.max.y < b.min.y || a.min.y > b.max.y);
+    }
+    static bool Contains(const BoundsAABB &outer, const BoundsAABB &inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && inner.max.x <= outer.max.x &&
+               inner.max.y <= outer.max.y;
+    }
+    static BoundsAABB Combine(const BoundsAABB &a, const BoundsAABB &b)
+    {
+        return {{std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y)},
+                {std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y)}};
+    }
+    static float Perimeter(const BoundsAABB &a) { return 2.0f * ((a.max.x - a.min.x) + (a.max.y - a.min.y)); }
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t node);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t node);
+    void Refit(int32_t node);
+
+    std::vector<TreeNode> m_Nodes;
+    int32_t m_Root = NullNode;
+    int32_t m_FreeList = NullNode;
+    float m_Margin;
+    mutable std::vector<int32_t> m_Stack; // Query traversal scratch
+};
+
+template <typename Callback> void DynamicAABBTree::Query(const BoundsAABB &aabb, Callback &&callback) const
+{
+    if (m_Root == NullNode)
+        return;
+
+    // Callbacks must not modify the tree, so the shared traversal stack is safe to reuse
+    size_t base = m_Stack.size();
+    m_Stack.push_back(m_Root);
+    while (m_Stack.size() > base)
+    {
+        int32_t index = m_Stack.back();
+        m_Stack.pop_back();
+
+        const TreeNode &node = m_Nodes[index];
+        if (!Overlaps(node.aabb, aabb))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (!callback(index))
+                break;
+        }
+        else
+        {
+            m_Stack.push_back(node.child1);
+            m_Stack.push_back(node.child2);
+        }
+    }
+    m_Stack.resize(base);
+}
+
+template <typename Callback>
+void DynamicAABBTree::RayCast(const TEVector2 &origin, const TEVector2 &direction, float maxDistance, float radius,
+                              std::vector<int32_t> &stack, Callback &&callback) const
+{
+    if (m_Root == NullNode)
+        return;
+
+    // Slab test against the node bounds, clipped to the current maximum distance
+    auto crosses = [&](const BoundsAABB &aabb)
+    {
+        float tMin = 0.0f, tMax = maxDistance;
+        const float dirs[2] = {direction.x, direction.y};
+        const float origins[2] = {origin.x, origin.y};
+        const float mins[2] = {aabb.min.x - radius, aabb.min.y - radius};
+        const float maxs[2] = {aabb.max.x + radius, aabb.max.y + radius};
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (dirs[axis] == 0.0f)
+            {
+                if (origins[axis] < mins[axis] || origins[axis] > maxs[axis])
+                    return false;
+                continue;
+            }
+            float inv = 1.0f / dirs[axis];
+            float t1 = (mins[axis] - origins[axis]) * inv;
+            float t2 = (maxs[axis] - origins[axis]) * inv;
+            tMin = std::max(tMin, std::min(t1, t2));
+            tMax = std::min(tMax, std::max(t1, t2));
+            if (tMin > tMax)
+                return false;
+        }
+        return true;
+    };
+
+    size_t base = stack.size();
+    stack.push_back(m_Root);
+    while (stack.size() > base)
+    {
+        int32_t index = stack.back();
+        stack.pop_back();
+
+        const TreeNode &node = m_Nodes[index];
+        if (!crosses(node.aabb))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            maxDistance = callback(index, maxDistance);
+            if (maxDistance <= 0.0f)
+                break;
+        }
+        else
+        {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    stack.resize(base);
+}
+
+} // namespace TE
@@ -27,6 +27,7 @@ public:
             TEVector4 p = worldTransform * TEVector4(v.x + Offset.x, v.y + Offset.y, 0.0f, 1.0f);
             shape.polygon.points.push_back({p.x, p.y});
         }
+        shape.UpdateVertexCache();
     }
 };
 
@@ -27,6 +27,7 @@ public:
             TEVector4 p = worldTransform * TEVector4(pts[i].x + Offset.x, pts[i].y + Offset.y, 0.0f, 1.0f);
             shape.triangle.points[i] = {p.x, p.y};
         }
+        shape.UpdateVertexCache();
     }
 };
 
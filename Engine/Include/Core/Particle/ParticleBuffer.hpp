@@ -0,0 +1,123 @@
+#pragma once
+#include "ParticleTypes.hpp"
+#include <vector>
+
+namespace TE
+{
+
+// Structure-of-arrays particle storage for ParticleUpdater's vectorized update. Live particles occupy [0, Count)
+// of every array; killing one moves the last live particle into its slot, so an update never visits a dead slot.
+// Particle order is therefore not stable.
+class ParticleBuffer
+{
+public:
+    // Each array holds Capacity floats; the first Count are live
+    float *PositionX, *PositionY, *PositionZ;
+    float *VelocityX, *VelocityY, *VelocityZ;
+    float *AccelerationX, *AccelerationY, *AccelerationZ;
+    float *ColorR, *ColorG, *ColorB, *ColorA;
+    float *Size;
+    float *Lifetime;
+    float *MaxLifetime;
+    float *Rotation;
+
+    size_t Count = 0;
+    size_t Capacity;
+
+    ParticleBuffer(size_t maxCount = 1000) : Capacity(maxCount)
+    {
+        // Whole pages per array plus a cache line, so the streams an update touches together do not start at
+        // the same page offset and falsely alias each other's stores
+        m_Stride = (Capacity + 1023) / 1024 * 1024 + 16;
+        m_Storage.resize(m_Stride * ArrayCount);
+        BindArrays();
+    }
+
+    ParticleBuffer(const ParticleBuffer &other)
+        : Count(other.Count), Capacity(other.Capacity), m_Storage(other.m_Storage), m_Stride(other.m_Stride)
+    {
+        BindArrays();
+    }
+
+    ParticleBuffer &operator=(const ParticleBuffer &other)
+    {
+        Count = other.Count;
+        Capacity = other.Capacity;
+        m_Storage = other.m_Storage;
+        m_Stride = other.m_Stride;
+        BindArrays();
+        return *this;
+    }
+
+    // Returns false when the buffer is full
+    bool Spawn(const Particle &p)
+    {
+        if (Count >= Capacity)
+            return false;
+
+        size_t i = Count++;
+        PositionX[i] = p.Position.x;
+        PositionY[i] = p.Position.y;
+        PositionZ[i] = p.Position.z;
+        VelocityX[i] = p.Velocity.x;
+        VelocityY[i] = p.Velocity.y;
+        VelocityZ[i] = p.Velocity.z;
+        AccelerationX[i] = p.Acceleration.x;
+        AccelerationY[i] = p.Acceleration.y;
+        AccelerationZ[i] = p.Acceleration.z;
+        ColorR[i] = p.Color.x;
+        ColorG[i] = p.Color.y;
+        ColorB[i] = p.Color.z;
+        ColorA[i] = p.Color.w;
+        Size[i] = p.Size;
+        Lifetime[i] = p.Lifetime;
+        MaxLifetime[i] = p.MaxLifetime;
+        Rotation[i] = p.Rotation;
+        return true;
+    }
+
+    // Swap-remove: the last live particle takes the index
+    void Kill(size_t index)
+    {
+        size_t last = --Count;
+        if (index == last)
+            return;
+        for (size_t array = 0; array < ArrayCount; ++array)
+            m_Storage[array * m_Stride + index] = m_Storage[array * m_Stride + last];
+    }
+
+    Particle Get(size_t i) const
+    {
+        Particle p;
+        p.Position = {PositionX[i], PositionY[i], PositionZ[i]};
+        p.Velocity = {VelocityX[i], VelocityY[i], VelocityZ[i]};
+        p.Acceleration = {AccelerationX[i], AccelerationY[i], AccelerationZ[i]};
+        p.Color = {ColorR[i], ColorG[i], ColorB[i], ColorA[i]};
+        p.Size = Size[i];
+        p.Lifetime = Lifetime[i];
+        p.MaxLifetime = MaxLifetime[i];
+        p.Rotation = Rotation[i];
+        p.Active = i < Count;
+        return p;
+    }
+
+    void Clear() { Count = 0; }
+
+private:
+    static constexpr size_t ArrayCount = 17;
+
+    void BindArrays()
+    {
+        float **arrays[ArrayCount] = {&PositionX, &PositionY,     &PositionZ,     &VelocityX,     &VelocityY,
+                                      &VelocityZ, &AccelerationX, &AccelerationY, &AccelerationZ, &ColorR,
+                                      &ColorG,    &ColorB,        &ColorA,        &Size,          &Lifetime,
+                                      &MaxLifetime, &Rotation};
+        for (size_t i = 0; i < ArrayCount; ++i)
+            *arrays[i] = m_Storage.data() + i * m_Stride;
+    }
+
+    std::vector<float> m_Storage; // All arrays, m_Stride floats apart
+    size_t m_Stride = 0;
+};
+
+} // namespace TE
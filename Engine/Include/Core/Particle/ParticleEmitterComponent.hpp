@@ -1,6 +1,8 @@
 #pragma once
+#include "ParticleBuffer.hpp"
 #include "ParticlePool.hpp"
 #include "Utils/MathUtils.hpp"
+#include <memory>
 
 namespace TE
 {
@@ -17,7 +19,12 @@ struct ParticleEmitterComponent
     float ParticleSize = 1.0f;
 
     float Accumulator = 0.0f;
+    size_t MaxParticles = 1000; // Capacity of Buffer
+
+    // Particles live in the emitter's own SoA Buffer, which ParticleSpawner creates on the first Emit. An external
+    // AoS Pool, when set, is used instead.
     ParticlePool *Pool = nullptr;
+    std::unique_ptr<ParticleBuffer> Buffer;
 
     bool PhysicsSimulated = false;
     float Bounciness = 0.5f;
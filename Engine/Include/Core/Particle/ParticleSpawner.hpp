@@ -8,6 +8,13 @@ namespace TE {
         void Emit(ParticleEmitterComponent& emitter, float deltaTime) {
             emitter.Accumulator += emitter.EmitRate * deltaTime;
 
+            if (!emitter.Pool) {
+                if (!emitter.Buffer)
+                    emitter.Buffer = std::make_unique<ParticleBuffer>(emitter.MaxParticles);
+                EmitInto(emitter, *emitter.Buffer);
+                return;
+            }
+
             while (emitter.Accumulator >= 1.0f) {
                 Particle* p = emitter.Pool->Allocate();
                 if (!p) return;
@@ -24,6 +31,24 @@ namespace TE {
                 emitter.Accumulator -= 1.0f;
             }
         }
+
+    private:
+        void EmitInto(ParticleEmitterComponent& emitter, ParticleBuffer& buffer) {
+            Particle p;
+            p.Position = emitter.EmissionPosition;
+            p.Velocity = emitter.BaseVelocity;
+            p.Acceleration = emitter.BaseAcceleration;
+            p.Color = emitter.StartColor;
+            p.Size = emitter.ParticleSize;
+            p.Lifetime = p.MaxLifetime = emitter.ParticleLife;
+            p.Rotation = 0.0f;
+            p.Active = true;
+
+            while (emitter.Accumulator >= 1.0f) {
+                if (!buffer.Spawn(p)) return;
+                emitter.Accumulator -= 1.0f;
+            }
+        }
     };
 
 }
@@ -1,7 +1,18 @@
 #pragma once
 #include "Core/Physics/PhysicsWorld.hpp"
+#include "ParticleBuffer.hpp"
+#include "ParticleEmitterComponent.hpp"
 #include "ParticlePool.hpp"
 
+// The widest instruction set the compiler targets picks the SoA kernel; anything else uses the scalar loop
+#if defined(__AVX__)
+#include <immintrin.h>
+#define TE_PARTICLE_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TE_PARTICLE_SSE
+#endif
+
 namespace TE
 {
 
@@ -11,55 +22,61 @@ public:
     void Update(ParticlePool &pool, float deltaTime, PhysicsWorld *physicsWorld = nullptr,
                 bool physicsSimulated = false, float bounciness = 0.5f)
     {
-        for (auto &p : pool.Particles)
+        // Every moving particle's step becomes one segment of a single batched query
+        m_Queries.clear();
+        m_QueryParticles.clear();
+        if (physicsSimulated && physicsWorld)
         {
-            if (!p.Active)
-                continue;
-
-            if (physicsSimulated && physicsWorld)
+            for (size_t i = 0; i < pool.Particles.size(); ++i)
             {
-                TEVector2 start = {p.Position.x, p.Position.y};
+                const Particle &p = pool.Particles[i];
+                if (!p.Active)
+                    continue;
+
                 TEVector2 velocity2D = {p.Velocity.x, p.Velocity.y};
                 float length = velocity2D.Length();
-
                 if (length > 0.0001f)
                 {
-                    TEVector2 dir = velocity2D.Normalized();
-                    float maxDistance = length * deltaTime;
-                    TEVector2 hitPoint;
-                    TEVector2 hitNormal;
-                    float fraction = 0.0f;
-                    uint32_t hitEntityID = 0;
-
-                    if (physicsWorld->Raycast(start, dir, maxDistance, hitPoint, hitNormal, fraction, hitEntityID))
-                    {
-                        // Bounce particle position slightly away from the hit surface
-                        TEVector2 bouncePos = hitPoint + hitNormal * 0.01f;
-                        p.Position.x = bouncePos.x;
-                        p.Position.y = bouncePos.y;
-
-                        // Reflect velocity
-                        float dotVal = Dot(velocity2D, hitNormal);
-                        TEVector2 reflected = velocity2D - hitNormal * (2.0f * dotVal);
-                        reflected = reflected * bounciness;
-
-                        p.Velocity.x = reflected.x;
-                        p.Velocity.y = reflected.y;
-                    }
-                    else
-                    {
-                        p.Position.x += p.Velocity.x * deltaTime;
-                        p.Position.y += p.Velocity.y * deltaTime;
-                        p.Position.z += p.Velocity.z * deltaTime;
-                    }
-                }
-                else
-                {
-                    p.Position.x += p.Velocity.x * deltaTime;
-                    p.Position.y += p.Velocity.y * deltaTime;
-                    p.Position.z += p.Velocity.z * deltaTime;
+                    RaycastQuery query;
+                    query.Origin = {p.Position.x, p.Position.y};
+                    query.Direction = velocity2D.Normalized();
+                    query.MaxDistance = length * deltaTime;
+                    m_Queries.push_back(query);
+                    m_QueryParticles.push_back(i);
                 }
             }
+
+            m_Hits.resize(m_Queries.size());
+            physicsWorld->RaycastBatch(m_Queries.data(), m_Hits.data(), m_Queries.size());
+        }
+
+        size_t nextQuery = 0;
+        for (size_t i = 0; i < pool.Particles.size(); ++i)
+        {
+            Particle &p = pool.Particles[i];
+            if (!p.Active)
+                continue;
+
+            const RaycastHit *hit = nullptr;
+            if (nextQuery < m_QueryParticles.size() && m_QueryParticles[nextQuery] == i)
+                hit = &m_Hits[nextQuery++];
+
+            if (hit && hit->Hit)
+            {
+                // Bounce particle position slightly away from the hit surface
+                TEVector2 bouncePos = hit->Point + hit->Normal * 0.01f;
+                p.Position.x = bouncePos.x;
+                p.Position.y = bouncePos.y;
+
+                // Reflect velocity
+                TEVector2 velocity2D = {p.Velocity.x, p.Velocity.y};
+                float dotVal = Dot(velocity2D, hit->Normal);
+                TEVector2 reflected = velocity2D - hit->Normal * (2.0f * dotVal);
+                reflected = reflected * bounciness;
+
+                p.Velocity.x = reflected.x;
+                p.Velocity.y = reflected.y;
+            }
             else
             {
                 p.Position.x += p.Velocity.x * deltaTime;
@@ -78,6 +95,182 @@ public:
                 p.Active = false;
         }
     }
+
+    // Steps whichever storage holds the emitter's particles, with its collision settings
+    void Update(ParticleEmitterComponent &emitter, float deltaTime, PhysicsWorld *physicsWorld = nullptr)
+    {
+        if (emitter.Pool)
+            Update(*emitter.Pool, deltaTime, physicsWorld, emitter.PhysicsSimulated, emitter.Bounciness);
+        else if (emitter.Buffer)
+            Update(*emitter.Buffer, deltaTime, physicsWorld, emitter.PhysicsSimulated, emitter.Bounciness);
+    }
+
+    // Same step for SoA storage. Integration, aging and alpha fade run as one vectorized pass over the live
+    // range; collisions are applied to the hit particles afterwards and the dead are swap-removed last.
+    void Update(ParticleBuffer &buffer, float deltaTime, PhysicsWorld *physicsWorld = nullptr,
+                bool physicsSimulated = false, float bounciness = 0.5f)
+    {
+        m_Queries.clear();
+        m_QueryParticles.clear();
+        m_QueryStates.clear();
+        if (physicsSimulated && physicsWorld)
+        {
+            for (size_t i = 0; i < buffer.Count; ++i)
+            {
+                TEVector2 velocity2D = {buffer.VelocityX[i], buffer.VelocityY[i]};
+                float length = velocity2D.Length();
+                if (length > 0.0001f)
+                {
+                    RaycastQuery query;
+                    query.Origin = {buffer.PositionX[i], buffer.PositionY[i]};
+                    query.Direction = velocity2D.Normalized();
+                    query.MaxDistance = length * deltaTime;
+                    m_Queries.push_back(query);
+                    m_QueryParticles.push_back(i);
+                    m_QueryStates.push_back({velocity2D, buffer.PositionZ[i]});
+                }
+            }
+
+            m_Hits.resize(m_Queries.size());
+            physicsWorld->RaycastBatch(m_Queries.data(), m_Hits.data(), m_Queries.size());
+        }
+
+        m_Dead.clear();
+        Integrate(buffer, deltaTime);
+
+        for (size_t q = 0; q < m_Queries.size(); ++q)
+        {
+            const RaycastHit &hit = m_Hits[q];
+            if (!hit.Hit)
+                continue;
+
+            // Undo the free step: bounce off the surface and reflect the pre-step velocity
+            size_t i = m_QueryParticles[q];
+            const QueryState &state = m_QueryStates[q];
+            TEVector2 bouncePos = hit.Point + hit.Normal * 0.01f;
+            buffer.PositionX[i] = bouncePos.x;
+            buffer.PositionY[i] = bouncePos.y;
+            buffer.PositionZ[i] = state.PositionZ;
+
+            float dotVal = Dot(state.Velocity, hit.Normal);
+            TEVector2 reflected = (state.Velocity - hit.Normal * (2.0f * dotVal)) * bounciness;
+            buffer.VelocityX[i] = reflected.x + buffer.AccelerationX[i] * deltaTime;
+            buffer.VelocityY[i] = reflected.y + buffer.AccelerationY[i] * deltaTime;
+        }
+
+        // Highest index first, so the particle swapped into a freed slot has already been checked
+        for (size_t d = m_Dead.size(); d-- > 0;)
+            buffer.Kill(m_Dead[d]);
+    }
+
+private:
+    struct QueryState
+    {
+        TEVector2 Velocity;
+        float PositionZ;
+    };
+
+    // Position += velocity * dt, velocity += acceleration * dt, lifetime -= dt, alpha = lifetime / max lifetime;
+    // indices whose lifetime ran out are appended to m_Dead in ascending order
+    void Integrate(ParticleBuffer &b, float dt)
+    {
+        float *px = b.PositionX, *py = b.PositionY, *pz = b.PositionZ;
+        float *vx = b.VelocityX, *vy = b.VelocityY, *vz = b.VelocityZ;
+        const float *ax = b.AccelerationX, *ay = b.AccelerationY, *az = b.AccelerationZ;
+        float *life = b.Lifetime, *alpha = b.ColorA;
+        const float *maxLife = b.MaxLifetime;
+        size_t count = b.Count;
+        size_t i = 0;
+
+#if defined(TE_PARTICLE_AVX)
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 zero = _mm256_setzero_ps();
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 velocityX = _mm256_loadu_ps(vx + i);
+            __m256 velocityY = _mm256_loadu_ps(vy + i);
+            __m256 velocityZ = _mm256_loadu_ps(vz + i);
+            __m256 accelerationX = _mm256_loadu_ps(ax + i);
+            __m256 accelerationY = _mm256_loadu_ps(ay + i);
+            __m256 accelerationZ = _mm256_loadu_ps(az + i);
+            _mm256_storeu_ps(px + i, _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(velocityX, step)));
+            _mm256_storeu_ps(py + i, _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(velocityY, step)));
+            _mm256_storeu_ps(pz + i, _mm256_add_ps(_mm256_loadu_ps(pz + i), _mm256_mul_ps(velocityZ, step)));
+            _mm256_storeu_ps(vx + i, _mm256_add_ps(velocityX, _mm256_mul_ps(accelerationX, step)));
+            _mm256_storeu_ps(vy + i, _mm256_add_ps(velocityY, _mm256_mul_ps(accelerationY, step)));
+            _mm256_storeu_ps(vz + i, _mm256_add_ps(velocityZ, _mm256_mul_ps(accelerationZ, step)));
+
+            __m256 remaining = _mm256_sub_ps(_mm256_loadu_ps(life + i), step);
+            _mm256_storeu_ps(life + i, remaining);
+            _mm256_storeu_ps(alpha + i, _mm256_div_ps(remaining, _mm256_loadu_ps(maxLife + i)));
+
+            int dead = _mm256_movemask_ps(_mm256_cmp_ps(remaining, zero, _CMP_LE_OQ));
+            for (; dead; dead &= dead - 1)
+                m_Dead.push_back(i + CountTrailingZeros(dead));
+        }
+#elif defined(TE_PARTICLE_SSE)
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 velocityX = _mm_loadu_ps(vx + i);
+            __m128 velocityY = _mm_loadu_ps(vy + i);
+            __m128 velocityZ = _mm_loadu_ps(vz + i);
+            __m128 accelerationX = _mm_loadu_ps(ax + i);
+            __m128 accelerationY = _mm_loadu_ps(ay + i);
+            __m128 accelerationZ = _mm_loadu_ps(az + i);
+            _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velocityX, step)));
+            _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velocityY, step)));
+            _mm_storeu_ps(pz + i, _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(velocityZ, step)));
+            _mm_storeu_ps(vx + i, _mm_add_ps(velocityX, _mm_mul_ps(accelerationX, step)));
+            _mm_storeu_ps(vy + i, _mm_add_ps(velocityY, _mm_mul_ps(accelerationY, step)));
+            _mm_storeu_ps(vz + i, _mm_add_ps(velocityZ, _mm_mul_ps(accelerationZ, step)));
+
+            __m128 remaining = _mm_sub_ps(_mm_loadu_ps(life + i), step);
+            _mm_storeu_ps(life + i, remaining);
+            _mm_storeu_ps(alpha + i, _mm_div_ps(remaining, _mm_loadu_ps(maxLife + i)));
+
+            int dead = _mm_movemask_ps(_mm_cmple_ps(remaining, zero));
+            for (; dead; dead &= dead - 1)
+                m_Dead.push_back(i + CountTrailingZeros(dead));
+        }
+#endif
+
+        // Scalar fallback, and the tail the vector loop left over
+        for (; i < count; ++i)
+        {
+            px[i] += vx[i] * dt;
+            py[i] += vy[i] * dt;
+            pz[i] += vz[i] * dt;
+            vx[i] += ax[i] * dt;
+            vy[i] += ay[i] * dt;
+            vz[i] += az[i] * dt;
+
+            life[i] -= dt;
+            alpha[i] = life[i] / maxLife[i];
+            if (life[i] <= 0.0f)
+                m_Dead.push_back(i);
+        }
+    }
+
+    // Index of the lowest set bit of a non-zero lane mask
+    static size_t CountTrailingZeros(int mask)
+    {
+        size_t index = 0;
+        while (!(mask & 1))
+        {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    // Reused between updates
+    std::vector<RaycastQuery> m_Queries;
+    std::vector<RaycastHit> m_Hits;
+    std::vector<size_t> m_QueryParticles;
+    std::vector<QueryState> m_QueryStates;
+    std::vector<size_t> m_Dead;
 };
 
 } // namespace TE
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TE
+{
+
+// Ring buffer of PhysicsWorld::CaptureState blobs for rewind. Every KeyframeInterval-th snapshot, and any whose
+// size differs from the one before, is stored whole; the others as a DeltaCodec delta against the snapshot
+// before them, which is small since static and sleeping bodies leave their bytes unchanged.
+class PhysicsStateHistory
+{
+public:
+    explicit PhysicsStateHistory(size_t capacity = 600, size_t keyframeInterval = 60);
+
+    void Push(const std::vector<uint8_t> &state);
+
+    // age 0 is the newest snapshot; returns false when fewer than age + 1 are stored
+    bool Get(size_t age, std::vector<uint8_t> &outState) const;
+
+    // Drops the newest count snapshots, e.g. after rewinding to branch off an older one
+    void DiscardNewest(size_t count);
+    void Clear();
+
+    size_t Size() const { return m_Count; }
+    size_t Capacity() const { return m_Entries.size(); }
+    size_t GetMemoryUsage() const;
+
+private:
+    struct Entry
+    {
+        std::vector<uint8_t> Data;
+        bool Keyframe = false;
+    };
+
+    size_t Slot(size_t age) const { return (m_Head + m_Entries.size() - 1 - age) % m_Entries.size(); }
+    bool Reconstruct(size_t age, std::vector<uint8_t> &outState) const;
+
+    std::vector<Entry> m_Entries;
+    size_t m_Head = 0; // Slot the next snapshot goes into
+    size_t m_Count = 0;
+    size_t m_KeyframeInterval;
+    size_t m_SinceKeyframe = 0;
+    std::vector<uint8_t> m_Newest; // Full copy of the newest snapshot, the base of the next delta
+};
+
+} // namespace TE
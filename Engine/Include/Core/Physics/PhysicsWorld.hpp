@@ -1,14 +1,20 @@
 #pragma once
 #include "Core/Collision/CollisionTypes.hpp"
+#include "Core/Collision/DynamicAABBTree.hpp"
+#include "Core/PreRequisites.h"
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace TE
 {
 
+class PhysicsWorld;
+
 struct RigidBody
 {
     TEVector2 Position;
+    TEVector2 PreviousPosition; // Position before the last fixed step, for render interpolation
     TEVector2 Velocity;
     TEVector2 Force;
     float Mass = 1.0f;
@@ -18,15 +24,23 @@ struct RigidBody
     bool IsSleeping = false;
 
     CollisionShape Shape;
-    uint32_t m_VeloxEntityID = 0;
+    uint32_t m_VeloxEntityID = 0; // Physics entity ID; stays valid when RestoreState rebuilds the Velox world
+    uint32_t m_WorldIndex = 0xFFFFFFFFu; // Slot in the owning world's body arrays
+    PhysicsWorld *m_World = nullptr;
 
     void ApplyForce(const TEVector2 &force)
     {
         if (IsStatic)
             return;
         Force += force;
+        if (IsSleeping)
+            Wake();
     }
 
+    // Sleeping bodies are skipped by PhysicsWorld::Step; call after setting Velocity on one directly, and after
+    // setting Position on any body so scene queries see the new position
+    void Wake();
+
     void Integrate(float dt)
     {
         if (IsStatic || InverseMass == 0.0f)
@@ -42,7 +56,25 @@ struct RigidBody
     }
 };
 
-class PhysicsWorld
+// Segment query for RaycastBatch; a Radius above zero sweeps a circle along the segment instead of a point
+struct RaycastQuery
+{
+    TEVector2 Origin;
+    TEVector2 Direction; // Normalized
+    float MaxDistance = 0.0f;
+    float Radius = 0.0f;
+};
+
+struct RaycastHit
+{
+    TEVector2 Point;        // On the body's surface
+    TEVector2 Normal;       // Surface normal at Point
+    float Fraction = 1.0f;  // Of MaxDistance
+    uint32_t EntityID = 0;  // Velox entity ID, as reported by Raycast
+    bool Hit = false;
+};
+
+class TE_API PhysicsWorld
 {
 public:
     PhysicsWorld();
@@ -50,8 +82,36 @@ public:
 
     void AddBody(RigidBody *body);
     void RemoveBody(RigidBody *body);
+    // Puts a sleeping body back into the awake set so the next Step picks up changes made to it, and moves the
+    // body's query proxy to its current position
+    void WakeBody(RigidBody *body);
 
+    // Step only visits the awake set: bodies in an island with at least one awake body. An island is found
+    // each step from the awake bodies at their post-step positions, the sleeping dynamic bodies whose bounds
+    // touch them, and every dynamic body joined to a member; static bodies never join islands. Once every body
+    // of an island is asleep, the island leaves the set.
     void Step(float dt);
+    size_t GetBodyCount() const { return m_Bodies.size(); }
+    size_t GetAwakeBodyCount() const { return m_AwakeBodies.size(); }
+    size_t GetAwakeIslandCount() const { return m_AwakeIslandCount; }
+
+    // Fixed-timestep driver: accumulates frame time and runs whole Steps of GetFixedDeltaTime(), at most
+    // maxSubSteps per call. Time beyond that is dropped so a slow frame cannot snowball. Returns the steps run.
+    int Advance(float frameDeltaTime);
+
+    void SetTickRate(float ticksPerSecond);
+    float GetTickRate() const { return 1.0f / m_FixedDeltaTime; }
+    float GetFixedDeltaTime() const { return m_FixedDeltaTime; }
+    void SetMaxSubSteps(int maxSubSteps) { m_MaxSubSteps = maxSubSteps > 0 ? maxSubSteps : 1; }
+    int GetMaxSubSteps() const { return m_MaxSubSteps; }
+
+    // Fraction of a fixed step left in the accumulator; blends PreviousPosition towards Position
+    float GetInterpolationAlpha() const { return m_Accumulator / m_FixedDeltaTime; }
+    TEVector2 GetInterpolatedPosition(const RigidBody &body) const
+    {
+        float alpha = GetInterpolationAlpha();
+        return body.PreviousPosition + (body.Position - body.PreviousPosition) * alpha;
+    }
 
     // Gravity Control
     void SetGravity(const TEVector2 &gravity);
@@ -82,6 +142,7 @@ public:
                                 float jointCompliance, float nodeRadius);
     uint32_t CreateSoftBodyShapeMatched(const TEVector2 &center, float *verticesX, float *verticesY, int vertexCount,
                                         float stiffness, float nodeRadius);
+    size_t GetSoftBodyCount() const { return m_SoftBodies.size(); }
     int GetSoftBodyNodeCount(uint32_t softBodyEntityID);
     uint32_t GetSoftBodyNode(uint32_t softBodyEntityID, int nodeIndex);
 
@@ -89,12 +150,176 @@ public:
     bool Raycast(const TEVector2 &start, const TEVector2 &direction, float maxDistance, TEVector2 &hitPoint,
                  TEVector2 &hitNormal, float &fraction, uint32_t &hitEntityID);
 
+    // ===== Snapshots =====
+    // CaptureState writes the simulation state of every body (pose, velocity, pending force, sleep state) plus
+    // the tick counter and step accumulator into a compact binary blob. RestoreState loads one back and
+    // rebuilds the Velox world from it, replaying joints, soft bodies and collider settings on top. The body set
+    // must match the one that was captured. Snapshots cover rigid bodies only: Velox cannot place soft-body
+    // nodes, so both calls fail while the world has a soft body.
+    //
+    // Contract: every restore of one snapshot steps bit for bit the same way. A restore also steps the same way
+    // as the live world did from the capture when that world held no contacts Velox had warm-started, i.e. it
+    // had not stepped since it was built or restored. Otherwise the two drift apart by solver rounding, because
+    // Velox keeps its warm-start impulses internal and a rebuilt world starts them from zero.
+    bool CaptureState(std::vector<uint8_t> &outState) const;
+    bool RestoreState(const std::vector<uint8_t> &state);
+
+    // Checks the contract above from the current state: runs steps steps of GetFixedDeltaTime() live, then twice
+    // from a restore of the starting state, and restores the starting state once more. Fails if the restored
+    // runs differ, or with matchLive if they differ from the live run (only a warning without). Logs the first
+    // difference.
+    bool VerifyRestore(int steps, bool matchLive = false);
+    uint64_t GetTick() const { return m_Tick; }
+
+    // Batched queries against the bodies' shapes at their positions as of the last Step or WakeBody. All queries
+    // share one bounding volume tree over the bodies, and the batch is split over the CALC pool when
+    // parallelism != 1 (same meaning as TaskSystem::ParallelFor's chunk count). hits must hold count entries.
+    // Body rotation is not considered.
+    void RaycastBatch(const RaycastQuery *queries, RaycastHit *hits, size_t count, size_t parallelism = 1);
+
+    // Velox entity IDs of every body whose shape overlaps the circle; returns how many were appended
+    size_t OverlapCircle(const TEVector2 &center, float radius, std::vector<uint32_t> &outEntityIDs);
+
 private:
+    enum class JointType : uint8_t
+    {
+        Distance,
+        Revolute,
+        Prismatic,
+        Gear,
+        Pulley
+    };
+
+    // Construction history replayed by RestoreState; entity IDs are the stable ones handed out to callers
+    struct JointRecord
+    {
+        JointType Type;
+        uint32_t EntityA, EntityB;
+        float Params[13];
+    };
+
+    struct SoftBodyRecord
+    {
+        uint32_t EntityID;
+        bool ShapeMatched;
+        TEVector2 Center;
+        float Radius, Compliance, JointCompliance, Stiffness, NodeRadius;
+        int NodeCount;
+        std::vector<float> VerticesX, VerticesY;
+        std::vector<uint32_t> NodeIDs;
+    };
+
+    struct ColliderSettings
+    {
+        bool HasSensor = false, IsSensor = false;
+        bool HasGroup = false;
+        int GroupId = 0;
+    };
+
+    // One body of a snapshot as RestoreState parses it
+    struct BodyState
+    {
+        uint32_t EntityID;
+        TEVector2 Position, PreviousPosition, Velocity, SyncedVelocity, SimVelocity, Force;
+        float Rotation;
+        uint8_t Sleeping;
+    };
+
     std::vector<RigidBody *> m_Bodies;
     TEVector2 m_Gravity = {0.0f, -9.81f};
     void *m_VeloxWorld = nullptr;
 
+    float m_FixedDeltaTime = 1.0f / 60.0f;
+    float m_Accumulator = 0.0f;
+    int m_MaxSubSteps = 4;
+
+    // Sync state in SoA form, parallel to m_Bodies. A body's velocity is only pushed when it differs from the
+    // last value exchanged with Velox, and only awake dynamic bodies have their transforms and velocities read
+    // back.
+    std::vector<uint32_t> m_VeloxIDs;
+    std::vector<float> m_SyncedVelocityX;
+    std::vector<float> m_SyncedVelocityY;
+    std::vector<uint8_t> m_Sleeping;
+    std::vector<float> m_Rotations;
+    std::vector<float> m_SimVelocityX; // Velox-side velocity derived from the last step's displacement
+    std::vector<float> m_SimVelocityY;
+
+    // Awake set and islands. m_AwakeSlot and m_SettledSlot (parallel to m_Bodies) are a body's position in
+    // m_AwakeBodies and m_SettledBodies, or InvalidSlot. Island parents are union-find links, valid for bodies
+    // whose stamp matches the current step.
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+    std::vector<uint32_t> m_AwakeBodies;
+    std::vector<uint32_t> m_AwakeSlot;
+    std::vector<uint32_t> m_IslandParent;
+    std::vector<uint64_t> m_IslandStamp;
+    std::vector<uint8_t> m_IslandAwake;
+    std::vector<uint32_t> m_IslandBodies; // Members of the islands gathered this step
+    std::vector<uint32_t> m_SettledBodies; // Left the awake set last step; PreviousPosition still lags
+    std::vector<uint32_t> m_SettledSlot;
+    uint64_t m_IslandStep = 0;
+    size_t m_AwakeIslandCount = 0;
+
+    // Joint links between dynamic bodies by body index, in compressed rows: the bodies joined to body i are
+    // m_JointLinks[m_JointOffsets[i] .. m_JointOffsets[i + 1]). Rebuilt when bodies or joints change.
+    std::vector<uint32_t> m_JointOffsets;
+    std::vector<uint32_t> m_JointLinks;
+    bool m_JointGraphDirty = true;
+
+    // Entity IDs given to callers are stable and mapped to the Velox entity currently backing them.
+    // m_BodyByEntity maps an entity ID to its index in m_Bodies, InvalidSlot for removed bodies and other IDs.
+    uint32_t m_NextEntityID = 1;
+    std::vector<uint32_t> m_BodyByEntity;
+    std::unordered_map<uint32_t, uint32_t> m_EntityToVelox;
+    std::unordered_map<uint32_t, uint32_t> m_VeloxToEntity;
+    std::vector<JointRecord> m_Joints;
+    std::vector<SoftBodyRecord> m_SoftBodies;
+    std::unordered_map<uint32_t, ColliderSettings> m_ColliderSettings;
+    uint64_t m_Tick = 0;
+
+    // RestoreState scratch, kept so restores do not allocate once grown to the body count
+    std::vector<BodyState> m_RestoreBodies;
+    std::vector<uint32_t> m_RestoreTargets;
+
+    // Bounding volume tree over the bodies (one proxy each, parallel to m_Bodies) for scene queries and islands
+    DynamicAABBTree m_QueryTree;
+    std::vector<int32_t> m_QueryProxies;
+    std::vector<std::vector<int32_t>> m_RayStacks; // One traversal stack per RaycastBatch chunk, kept between calls
+
+    // Per-step batches handed across the Velox boundary
+    std::vector<uint32_t> m_BatchBodies;
+    std::vector<uint32_t> m_BatchIDs;
+    std::vector<float> m_BatchX;
+    std::vector<float> m_BatchY;
+    std::vector<float> m_BatchRotation;
+    std::vector<uint8_t> m_BatchSleeping;
+
     void ResolveCollisions();
+
+    void AddAwake(uint32_t index);
+    void RemoveAwake(uint32_t index);
+    void AddSettled(uint32_t index);
+    void RemoveSettled(uint32_t index);
+    void ClearSettled();
+    void BuildJointGraph();
+    void GatherIslands();
+    // Reads the transforms of m_BatchBodies back from Velox and derives their velocities
+    void ReadBackBodies(float dt);
+    uint32_t FindIsland(uint32_t index);
+
+    uint32_t RegisterEntity(uint32_t veloxID);
+    uint32_t ToVelox(uint32_t entityID) const;
+    uint32_t ToEntity(uint32_t veloxID) const;
+    void CreateVeloxBody(uint32_t index, float rotation, const TEVector2 &velocity);
+    void CreateVeloxSoftBody(SoftBodyRecord &record);
+    void CreateVeloxJoint(const JointRecord &joint);
+    void ApplyColliderSettings(uint32_t entityID, const ColliderSettings &settings);
+    void RebuildVeloxWorld();
 };
 
+inline void RigidBody::Wake()
+{
+    if (m_World)
+        m_World->WakeBody(this);
+}
+
 } // namespace TE
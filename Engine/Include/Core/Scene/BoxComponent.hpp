@@ -41,6 +41,16 @@ public:
         return v;
     }
 
+    bool CastsOcclusionShadow() const override { return bIsVisible; }
+
+    bool GetOcclusionShape(OcclusionShape &outShape) const override
+    {
+        outShape.Params[0] = Size.x;
+        outShape.Params[1] = Size.y;
+        outShape.Count = 2;
+        return true;
+    }
+
     bool ContainsPoint(const TE::TEMatrix4 &worldModel, const TEVector2 &point) const override
     {
         auto *collider = GetOwnerEntity().GetComponent<BoxColliderComponent>();
@@ -39,6 +39,15 @@ public:
         return v;
     }
 
+    bool CastsOcclusionShadow() const override { return bIsVisible; }
+
+    bool GetOcclusionShape(OcclusionShape &outShape) const override
+    {
+        outShape.Params[0] = Radius;
+        outShape.Count = 1;
+        return true;
+    }
+
     bool ContainsPoint(const TE::TEMatrix4 &worldModel, const TEVector2 &point) const override
     {
         auto *collider = GetOwnerEntity().GetComponent<CircleColliderComponent>();
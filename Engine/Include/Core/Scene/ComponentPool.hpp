@@ -0,0 +1,78 @@
+#pragma once
+#include "Core/PreRequisites.h"
+#include "Core/Scene/EntityID.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TE
+{
+
+class TComponent;
+
+// Sparse set of one component type. Entities owning the type are packed in dense arrays, so a view can
+// stream over them without touching unrelated entities, and a lookup is a paged array read instead of a
+// hash probe. Components stay individually allocated: their addresses are stable handles for the
+// parent/child links and caches that point at them.
+class TE_API ComponentPool
+{
+public:
+    static constexpr uint32_t PageBits = 12;
+    static constexpr uint32_t PageSize = 1u << PageBits;
+
+    // The entity must be alive; a stale ID would take over the slot of its successor
+    TComponent *Add(EntityID entity, std::unique_ptr<TComponent> component);
+    // Removes every instance owned by the entity; returns false if it had none
+    bool Remove(EntityID entity);
+    // Removes one instance; the entity leaves the set when it was its last one
+    bool RemoveInstance(EntityID entity, const TComponent *component);
+
+    bool Contains(EntityID entity) const { return FindDense(entity) != InvalidIndex; }
+
+    // First instance owned by the entity, or null
+    TComponent *Get(EntityID entity) const
+    {
+        uint32_t index = FindDense(entity);
+        return index == InvalidIndex ? nullptr : m_Primary[index];
+    }
+
+    // Every instance owned by the entity, or null
+    const std::vector<std::unique_ptr<TComponent>> *GetAll(EntityID entity) const
+    {
+        uint32_t index = FindDense(entity);
+        return index == InvalidIndex ? nullptr : &m_Instances[index];
+    }
+
+    // Packed arrays, valid until the pool is modified
+    size_t Size() const { return m_Entities.size(); }
+    const EntityID *GetEntities() const { return m_Entities.data(); }
+    TComponent *const *GetPrimaries() const { return m_Primary.data(); }
+    const std::vector<std::unique_ptr<TComponent>> &GetInstances(size_t denseIndex) const
+    {
+        return m_Instances[denseIndex];
+    }
+
+private:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    // The sparse array is indexed by slot; the dense entity check rejects stale generations
+    uint32_t FindDense(EntityID entity) const
+    {
+        uint32_t slot = GetEntitySlot(entity);
+        size_t page = slot >> PageBits;
+        if (page >= m_Sparse.size() || !m_Sparse[page])
+            return InvalidIndex;
+        uint32_t index = m_Sparse[page][slot & (PageSize - 1)];
+        return (index != InvalidIndex && m_Entities[index] == entity) ? index : InvalidIndex;
+    }
+    void SetDense(EntityID entity, uint32_t index);
+    void EraseDense(uint32_t index);
+
+    std::vector<std::unique_ptr<uint32_t[]>> m_Sparse; // Entity slot -> dense index, allocated page by page
+
+    std::vector<EntityID> m_Entities;                                  // Dense
+    std::vector<TComponent *> m_Primary;                               // Dense, first instance of each entity
+    std::vector<std::vector<std::unique_ptr<TComponent>>> m_Instances; // Dense, all instances of each entity
+};
+
+} // namespace TE
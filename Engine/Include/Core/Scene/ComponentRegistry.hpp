@@ -7,6 +7,7 @@
 #include <glm/glm.hpp>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <typeindex>
 #include <vector>
 
@@ -30,6 +31,9 @@ struct PropertyMetadata
     std::string EnumName;                            // If set, this property is an enum
     std::function<std::string(void *)> SerializeFunc = nullptr;
     std::function<void(void *, const std::string &)> DeserializeFunc = nullptr;
+    // Raw access for trivially copyable member properties (Size > 0), so state can be copied without text
+    std::function<void *(void *)> AddressFunc = nullptr;
+    size_t Size = 0;
 };
 
 using ComponentFactory = std::function<TComponent *(EntityManager *, EntityID)>;
@@ -109,6 +113,7 @@ public:
                                        Type *ptr = &(static_cast<Class *>(instance)->*member);
                                        TEPropertyDrawer<Type>::Deserialize(ptr, data);
                                    }});
+        SetRawAccess<Class, Type>(meta.Properties.back(), member);
         return true;
     }
 
@@ -213,6 +218,7 @@ public:
                                        EnumType *valPtr = &(static_cast<Class *>(instance)->*member);
                                        *valPtr = static_cast<EnumType>(std::stoi(data));
                                    }});
+        SetRawAccess<Class, EnumType>(meta.Properties.back(), member);
         return true;
     }
 
@@ -302,6 +308,19 @@ public:
 
 private:
     ComponentRegistry() : m_Components(), m_TypeToName(), m_Enums() {}
+
+    // Only direct members get raw access: getter-based properties may point at state owned elsewhere
+    // (transforms, hierarchy links) that must not be overwritten behind its owner's back
+    template <typename Class, typename Type> static void SetRawAccess(PropertyMetadata &prop, Type Class::*member)
+    {
+        if constexpr (std::is_trivially_copyable<Type>::value)
+        {
+            prop.AddressFunc = [member](void *instance) -> void *
+            { return &(static_cast<Class *>(instance)->*member); };
+            prop.Size = sizeof(Type);
+        }
+    }
+
     std::map<std::string, ComponentMetadata> m_Components;
     std::map<std::type_index, std::string> m_TypeToName;
     std::map<std::string, EnumMetadata> m_Enums;
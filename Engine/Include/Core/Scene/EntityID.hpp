@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+namespace TE
+{
+
+// Entity IDs pack a slot and a generation: (generation << 32) | (slot + 1). Slots are recycled after an
+// entity is destroyed and the generation is bumped, so a stale ID never matches the slot's new owner.
+// First-generation IDs are plain 1, 2, 3..., and 0 is never a valid ID.
+using EntityID = uint64_t;
+
+inline uint32_t GetEntitySlot(EntityID id) { return (uint32_t)(id & 0xFFFFFFFFu) - 1u; }
+inline uint32_t GetEntityGeneration(EntityID id) { return (uint32_t)(id >> 32); }
+inline EntityID MakeEntityID(uint32_t slot, uint32_t generation)
+{
+    return ((EntityID)generation << 32) | (EntityID)(slot + 1u);
+}
+
+} // namespace TE
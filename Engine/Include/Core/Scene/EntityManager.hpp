@@ -1,21 +1,24 @@
 #pragma once
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <unordered_map>
+#include <utility>
 
+#include "Core/Scene/ComponentPool.hpp"
+#include "Core/Scene/QueryCache.hpp"
 #include "GameFrameWork/TComponent.hpp"
 
 namespace TE
 {
 
-using EntityID = uint64_t;
-
 class EntityManager;
 
 // Entity wrapper with convenience methods
@@ -43,7 +46,129 @@ private:
     EntityManager *m_Manager;
 };
 
-class EntityManager
+// Entities owning every one of the Components types, iterated over the packed arrays of the smallest pool.
+// Adding or removing any of the viewed component types while iterating invalidates the view.
+template <typename... Components> class ComponentView
+{
+public:
+    static constexpr size_t Count = sizeof...(Components);
+
+    explicit ComponentView(const std::array<const ComponentPool *, Count> &pools) : m_Pools(pools)
+    {
+        for (const ComponentPool *pool : m_Pools)
+        {
+            if (!pool)
+            {
+                m_Driver = nullptr;
+                return;
+            }
+            if (!m_Driver || pool->Size() < m_Driver->Size())
+                m_Driver = pool;
+        }
+    }
+
+    // Upper bound on the number of entities Each visits
+    size_t SizeHint() const { return m_Driver ? m_Driver->Size() : 0; }
+
+    // Calls func(EntityID, Components &...) with the first instance of each type
+    template <typename Func> void Each(Func &&func) const
+    {
+        EachImpl(func, std::index_sequence_for<Components...>{});
+    }
+
+    // Single-type views only: calls func(EntityID, Component &) for every instance, not just the first
+    template <typename Func> void EachInstance(Func &&func) const
+    {
+        static_assert(Count == 1, "EachInstance is only available on single-type views");
+        if (!m_Driver)
+            return;
+        using Component = std::tuple_element_t<0, std::tuple<Components...>>;
+        const EntityID *entities = m_Driver->GetEntities();
+        for (size_t i = 0, size = m_Driver->Size(); i < size; ++i)
+        {
+            for (const auto &instance : m_Driver->GetInstances(i))
+                func(entities[i], *static_cast<Component *>(instance.get()));
+        }
+    }
+
+private:
+    template <typename Func, size_t... I> void EachImpl(Func &func, std::index_sequence<I...>) const
+    {
+        if (!m_Driver)
+            return;
+
+        const EntityID *entities = m_Driver->GetEntities();
+        TComponent *const *primaries = m_Driver->GetPrimaries();
+        for (size_t i = 0, size = m_Driver->Size(); i < size; ++i)
+        {
+            const EntityID entity = entities[i];
+            std::array<TComponent *, Count> components = {
+                (m_Pools[I] == m_Driver ? primaries[i] : m_Pools[I]->Get(entity))...};
+
+            bool complete = true;
+            for (TComponent *component : components)
+                complete = complete && component;
+            if (complete)
+                func(entity, *static_cast<Components *>(components[I])...);
+        }
+    }
+
+    std::array<const ComponentPool *, Count> m_Pools;
+    const ComponentPool *m_Driver = nullptr;
+};
+
+// Cached counterpart of ComponentView: only visits entities already known to match, yielding the first
+// instance of each type without allocating. Valid until the owning EntityManager is destroyed; adding or
+// removing any of the queried component types while iterating invalidates the iteration.
+template <typename... Components> class ComponentQuery
+{
+public:
+    static constexpr size_t Count = sizeof...(Components);
+    using Tuple = std::tuple<EntityID, Components &...>;
+
+    explicit ComponentQuery(const QueryCache *cache) : m_Cache(cache) {}
+
+    size_t Size() const { return m_Cache->Size(); }
+
+    // Calls func(EntityID, Components &...)
+    template <typename Func> void Each(Func &&func) const
+    {
+        for (size_t i = 0, size = m_Cache->Size(); i < size; ++i)
+            std::apply(func, Get(i, std::index_sequence_for<Components...>{}));
+    }
+
+    class Iterator
+    {
+    public:
+        Iterator(const ComponentQuery *query, size_t index) : m_Query(query), m_Index(index) {}
+        Tuple operator*() const { return m_Query->Get(m_Index, std::index_sequence_for<Components...>{}); }
+        Iterator &operator++()
+        {
+            ++m_Index;
+            return *this;
+        }
+        bool operator!=(const Iterator &other) const { return m_Index != other.m_Index; }
+
+    private:
+        const ComponentQuery *m_Query;
+        size_t m_Index;
+    };
+
+    // for (auto [entity, a, b] : query)
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, m_Cache->Size()); }
+
+private:
+    template <size_t... I> Tuple Get(size_t index, std::index_sequence<I...>) const
+    {
+        EntityID entity = m_Cache->GetEntities()[index];
+        return Tuple(entity, *static_cast<Components *>(m_Cache->GetPool(I)->Get(entity))...);
+    }
+
+    const QueryCache *m_Cache;
+};
+
+class TE_API EntityManager
 {
 public:
     EntityManager() = default;
@@ -54,8 +179,15 @@ public:
     // Entity management
     Entity CreateEntity();
     void DestroyEntity(Entity entity);
-    bool IsValid(EntityID id) const { return m_AliveEntities.find(id) != m_AliveEntities.end(); }
-    const std::set<EntityID> &GetAliveEntities() const { return m_AliveEntities; }
+    bool IsValid(EntityID id) const
+    {
+        uint32_t slot = GetEntitySlot(id);
+        return slot < m_Slots.size() && m_Slots[slot].Generation == GetEntityGeneration(id) &&
+               m_Slots[slot].AlivePosition != InvalidPosition;
+    }
+    // Alive entities in creation order. Creating entities while iterating invalidates the array; destroying
+    // them leaves 0 in their place until the next call.
+    const std::vector<EntityID> &GetAliveEntities() const;
 
     // Component management
     template <typename Component, typename... Args> Component *AddComponent(EntityID entityID, Args &&...args);
@@ -67,6 +199,34 @@ public:
     void RemoveComponentInstance(EntityID entityID, TComponent *component);
     void RemoveAllComponents(EntityID entityID);
     std::vector<TComponent *> GetAllComponents(EntityID entityID) const;
+    // Allocation-free counterparts: append to a caller-owned vector, or visit instances in place
+    void GetAllComponents(EntityID entityID, std::vector<TComponent *> &outComponents) const;
+    template <typename Component, typename Func> void ForEachComponent(EntityID entityID, Func &&func) const;
+
+    // Iterates the entities owning all of the given component types (exact types, as with GetComponent)
+    template <typename... Components> ComponentView<Components...> View() const
+    {
+        return ComponentView<Components...>({GetPool<Components>()...});
+    }
+
+    // Bumped whenever components are added, removed or reparented, or entities are created or destroyed
+    uint64_t GetStructureVersion() const { return m_StructureVersion; }
+    void MarkStructureChanged() { m_StructureVersion++; }
+
+    // Like View, but the match list is built once and then maintained as components are added and removed
+    template <typename... Components> ComponentQuery<Components...> Query();
+
+    template <typename Component> const ComponentPool *GetPool() const
+    {
+        static_assert(std::is_base_of<TComponent, Component>::value, "Component must derive from TComponent");
+        auto it = m_ComponentPools.find(std::type_index(typeid(Component)));
+        return it == m_ComponentPools.end() ? nullptr : &it->second;
+    }
+    const ComponentPool *GetPool(std::type_index type) const
+    {
+        auto it = m_ComponentPools.find(type);
+        return it == m_ComponentPools.end() ? nullptr : &it->second;
+    }
 
     // Global component registration (optional, for custom types)
     template <typename T> void RegisterComponent(const std::string &name)
@@ -86,11 +246,28 @@ public:
     }
 
 private:
-    EntityID m_NextEntityID = 1;
-    std::set<EntityID> m_AliveEntities;
-    std::unordered_map<std::type_index, std::unordered_map<EntityID, std::vector<std::unique_ptr<TComponent>>>>
-        m_ComponentPools;
+    static constexpr uint32_t InvalidPosition = 0xFFFFFFFFu;
+
+    struct EntitySlot
+    {
+        uint32_t Generation = 0;
+        mutable uint32_t AlivePosition = InvalidPosition; // Index into m_AliveEntities, patched on compaction
+    };
+
+    uint64_t m_StructureVersion = 0;
+    std::vector<EntitySlot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+    // Dense and ordered; destroyed entries are zeroed and compacted lazily so bulk destruction stays linear
+    mutable std::vector<EntityID> m_AliveEntities;
+    mutable size_t m_DeadAliveEntries = 0;
+    // Keeps every cached query that involves the type in sync with one entity's change
+    void RefreshQueries(std::type_index type, EntityID entityID);
+
+    std::unordered_map<std::type_index, ComponentPool> m_ComponentPools; // Node-based, pool addresses are stable
     std::map<std::string, std::function<TComponent *(EntityID)>> m_ComponentFactories;
+
+    std::unordered_map<std::type_index, std::unique_ptr<QueryCache>> m_Queries; // Keyed by ComponentQuery type
+    std::unordered_map<std::type_index, std::vector<QueryCache *>> m_QueriesByComponent;
 };
 
 // --- Template Implementations ---
@@ -114,44 +291,36 @@ template <typename Component, typename... Args>
 Component *EntityManager::AddComponent(EntityID entityID, Args &&...args)
 {
     static_assert(std::is_base_of<TComponent, Component>::value, "Component must derive from TComponent");
-    auto &pool = m_ComponentPools[std::type_index(typeid(Component))][entityID];
+    if (!IsValid(entityID))
+        return nullptr;
+    auto &pool = m_ComponentPools[std::type_index(typeid(Component))];
     auto comp = std::make_unique<Component>(std::forward<Args>(args)...);
     comp->SetOwner(reinterpret_cast<TObject *>(entityID));
     comp->SetEntityManager(this); // Set the manager pointer
     Component *ptr = comp.get();
-    pool.push_back(std::move(comp));
+    pool.Add(entityID, std::move(comp));
+    RefreshQueries(std::type_index(typeid(Component)), entityID);
+    MarkStructureChanged();
     return ptr;
 }
 
 template <typename Component> Component *EntityManager::GetComponent(EntityID entityID) const
 {
-    static_assert(std::is_base_of<TComponent, Component>::value, "Component must derive from TComponent");
-    auto it = m_ComponentPools.find(std::type_index(typeid(Component)));
-    if (it == m_ComponentPools.end())
-        return nullptr;
-    auto &entityPool = it->second;
-    auto compIt = entityPool.find(entityID);
-    if (compIt == entityPool.end() || compIt->second.empty())
-        return nullptr;
-    return static_cast<Component *>(compIt->second[0].get());
+    const ComponentPool *pool = GetPool<Component>();
+    return pool ? static_cast<Component *>(pool->Get(entityID)) : nullptr;
 }
 
 template <typename Component> std::vector<Component *> EntityManager::GetComponents(EntityID entityID) const
 {
-    static_assert(std::is_base_of<TComponent, Component>::value, "Component must derive from TComponent");
     std::vector<Component *> results;
-    auto it = m_ComponentPools.find(std::type_index(typeid(Component)));
-    if (it != m_ComponentPools.end())
+    const ComponentPool *pool = GetPool<Component>();
+    if (const auto *instances = pool ? pool->GetAll(entityID) : nullptr)
     {
-        auto &entityPool = it->second;
-        auto compIt = entityPool.find(entityID);
-        if (compIt != entityPool.end())
+        results.reserve(instances->size());
+        for (auto &comp : *instances)
         {
-            for (auto &comp : compIt->second)
-            {
-                if (auto *ptr = static_cast<Component *>(comp.get()))
-                    results.push_back(ptr);
-            }
+            if (auto *ptr = static_cast<Component *>(comp.get()))
+                results.push_back(ptr);
         }
     }
     return results;
@@ -159,13 +328,8 @@ template <typename Component> std::vector<Component *> EntityManager::GetCompone
 
 template <typename Component> bool EntityManager::HasComponent(EntityID entityID) const
 {
-    static_assert(std::is_base_of<TComponent, Component>::value, "Component must derive from TComponent");
-    auto it = m_ComponentPools.find(std::type_index(typeid(Component)));
-    if (it == m_ComponentPools.end())
-        return false;
-    const auto &entityPool = it->second;
-    auto compIt = entityPool.find(entityID);
-    return compIt != entityPool.end() && !compIt->second.empty();
+    const ComponentPool *pool = GetPool<Component>();
+    return pool && pool->Contains(entityID);
 }
 
 template <typename Component> void EntityManager::RemoveComponent(EntityID entityID)
@@ -174,24 +338,61 @@ template <typename Component> void EntityManager::RemoveComponent(EntityID entit
     auto it = m_ComponentPools.find(std::type_index(typeid(Component)));
     if (it == m_ComponentPools.end())
         return;
-    it->second.erase(entityID);
+    if (it->second.Remove(entityID))
+    {
+        RefreshQueries(it->first, entityID);
+        MarkStructureChanged();
+    }
+}
+
+template <typename Component, typename Func> void EntityManager::ForEachComponent(EntityID entityID, Func &&func) const
+{
+    const ComponentPool *pool = GetPool<Component>();
+    if (const auto *instances = pool ? pool->GetAll(entityID) : nullptr)
+    {
+        for (auto &comp : *instances)
+            func(*static_cast<Component *>(comp.get()));
+    }
+}
+
+template <typename... Components> ComponentQuery<Components...> EntityManager::Query()
+{
+    static_assert((std::is_base_of<TComponent, Components>::value && ...), "Component must derive from TComponent");
+    auto &cache = m_Queries[std::type_index(typeid(ComponentQuery<Components...>))];
+    if (!cache)
+    {
+        // Queried types get a pool up front so the cache can hold on to it
+        cache = std::make_unique<QueryCache>(
+            std::vector<const ComponentPool *>{&m_ComponentPools[std::type_index(typeid(Components))]...});
+        for (std::type_index type : {std::type_index(typeid(Components))...})
+        {
+            auto &caches = m_QueriesByComponent[type];
+            if (std::find(caches.begin(), caches.end(), cache.get()) == caches.end())
+                caches.push_back(cache.get());
+        }
+    }
+    return ComponentQuery<Components...>(cache.get());
 }
 
 inline std::vector<TComponent *> EntityManager::GetAllComponents(EntityID entityID) const
 {
     std::vector<TComponent *> results;
-    for (auto &[type, entityPool] : m_ComponentPools)
+    GetAllComponents(entityID, results);
+    return results;
+}
+
+inline void EntityManager::GetAllComponents(EntityID entityID, std::vector<TComponent *> &outComponents) const
+{
+    for (auto &[type, pool] : m_ComponentPools)
     {
-        auto compIt = entityPool.find(entityID);
-        if (compIt != entityPool.end())
+        if (const auto *instances = pool.GetAll(entityID))
         {
-            for (auto &comp : compIt->second)
+            for (auto &comp : *instances)
             {
-                results.push_back(comp.get());
+                outComponents.push_back(comp.get());
             }
         }
     }
-    return results;
 }
 
 } // namespace TE
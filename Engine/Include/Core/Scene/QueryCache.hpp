@@ -0,0 +1,45 @@
+#pragma once
+#include "Core/PreRequisites.h"
+#include "Core/Scene/ComponentPool.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace TE
+{
+
+// Entities owning every component type of one query, kept up to date by EntityManager as components are
+// added and removed, so a query never scans entities that cannot match.
+class TE_API QueryCache
+{
+public:
+    explicit QueryCache(std::vector<const ComponentPool *> pools);
+
+    bool Matches(EntityID entity) const;
+    bool Contains(EntityID entity) const { return FindIndex(entity) != InvalidIndex; }
+
+    // Re-tests one entity after one of its components changed
+    void Refresh(EntityID entity);
+    void Remove(EntityID entity);
+
+    size_t Size() const { return m_Entities.size(); }
+    const EntityID *GetEntities() const { return m_Entities.data(); }
+    const ComponentPool *GetPool(size_t index) const { return m_Pools[index]; }
+
+private:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t FindIndex(EntityID entity) const
+    {
+        uint32_t slot = GetEntitySlot(entity);
+        if (slot >= m_Index.size())
+            return InvalidIndex;
+        uint32_t index = m_Index[slot];
+        return (index != InvalidIndex && m_Entities[index] == entity) ? index : InvalidIndex;
+    }
+
+    std::vector<const ComponentPool *> m_Pools; // One per queried type, in query order
+    std::vector<EntityID> m_Entities;          // Dense matches
+    std::vector<uint32_t> m_Index;             // Entity slot -> index into m_Entities
+};
+
+} // namespace TE
@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Asset/Asset.hpp"
 #include "EntityManager.hpp"
+#include "TransformSystem.hpp"
 #include <memory>
 #include <string>
 
@@ -41,11 +42,13 @@ public:
     void SetParent(Entity child, Entity parent);
 
     EntityManager &GetEntityManager() { return m_EntityManager; }
+    TransformSystem &GetTransformSystem() { return m_TransformSystem; }
 
     static class ComponentRegistry &GetGlobalComponentRegistry();
 
 private:
     EntityManager m_EntityManager;
+    TransformSystem m_TransformSystem{m_EntityManager};
     AssetHandle m_Handle;
     std::string m_Name;
 };
@@ -0,0 +1,55 @@
+#pragma once
+#include "Core/PreRequisites.h"
+#include "Core/Scene/EntityID.hpp"
+#include "Utils/MathUtils.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace TE
+{
+class EntityManager;
+class TComponent;
+
+// Cached world matrices for every component of every entity with a TransformComponent.
+// World = entity transform * root component * ... * component, matching the editor's composition.
+// Nodes live in flat arrays ordered parent-before-child. The order is rebuilt only when components are added,
+// removed or reparented; each Update then recomputes just the nodes whose local transform changed, plus
+// their subtrees.
+class TE_API TransformSystem
+{
+public:
+    explicit TransformSystem(EntityManager &entityManager) : m_EntityManager(entityManager) {}
+
+    void Update();
+    // Forces the component and its subtree to be recomputed on the next Update
+    void MarkDirty(const TComponent *component);
+
+    // Cached world matrix as of the last Update; components added since then are computed on the spot
+    TEMatrix4 GetWorldMatrix(const TComponent *component) const;
+
+    // Flat traversal in parent-before-child order, entities in creation order
+    size_t GetNodeCount() const { return m_Nodes.size(); }
+    TComponent *GetNode(size_t index) const { return m_Nodes[index]; }
+    const TEMatrix4 &GetNodeWorldMatrix(size_t index) const { return m_World[index]; }
+
+    // Number of world matrices recomputed by the last Update
+    uint32_t GetLastRecomputeCount() const { return m_LastRecomputeCount; }
+
+private:
+    void Rebuild();
+    uint32_t AddNode(TComponent *component, int32_t parent);
+
+    EntityManager &m_EntityManager;
+    uint64_t m_BuiltVersion = ~0ull;
+    uint32_t m_LastRecomputeCount = 0;
+
+    std::vector<TComponent *> m_Nodes;
+    std::vector<int32_t> m_Parents;          // Node index, -1 for an entity's TransformComponent
+    std::vector<TETransform> m_LocalSource; // Local transform the cached matrices were built from
+    std::vector<TEMatrix4> m_World;
+    std::vector<uint8_t> m_Dirty;
+    std::unordered_map<const TComponent *, uint32_t> m_NodeIndex;
+};
+
+} // namespace TE
@@ -43,6 +43,19 @@ public:
         return v;
     }
 
+    bool CastsOcclusionShadow() const override { return bIsVisible; }
+
+    bool GetOcclusionShape(OcclusionShape &outShape) const override
+    {
+        outShape.Count = 0;
+        for (const TEVector2 *p : {&Point1, &Point2, &Point3})
+        {
+            outShape.Params[outShape.Count++] = p->x;
+            outShape.Params[outShape.Count++] = p->y;
+        }
+        return true;
+    }
+
     bool ContainsPoint(const TE::TEMatrix4 &worldModel, const TEVector2 &point) const override
     {
         auto *collider = GetOwnerEntity().GetComponent<TriangleColliderComponent>();
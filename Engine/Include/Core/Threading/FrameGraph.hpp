@@ -0,0 +1,78 @@
+#pragma once
+#include "Core/PreRequisites.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TE
+{
+
+// One pass as it ran in the last executed frame, in milliseconds from the start of Execute
+struct FrameTimelineEntry
+{
+    std::string Name;
+    float StartMs = 0.0f;
+    float EndMs = 0.0f;
+    int Thread = 0; // JobSystem worker index; 0 is the thread that called Execute
+};
+
+// Runs a frame's passes as a dependency graph on the JobSystem. Each pass names the resources it reads and
+// writes; the graph orders two passes only when they touch a common resource and at least one of them writes
+// it, in the order the passes were added, so the result matches running them serially in that order.
+// Everything else may overlap. Passes flagged MainThread (GL calls, input, UI state) run on the thread that
+// calls Execute, which otherwise helps with queued jobs until the frame is done.
+class TE_API FrameGraph
+{
+public:
+    using PassFunc = std::function<void()>;
+
+    size_t AddPass(const std::string &name, std::initializer_list<const char *> reads,
+                   std::initializer_list<const char *> writes, PassFunc func, bool mainThread = false);
+    void Clear();
+
+    // Runs every pass once and returns when all are done
+    void Execute();
+
+    size_t GetPassCount() const { return m_Passes.size(); }
+    const std::vector<FrameTimelineEntry> &GetTimeline() const { return m_Timeline; }
+    float GetLastFrameMs() const { return m_LastFrameMs; }
+
+private:
+    struct Pass
+    {
+        std::string Name;
+        std::vector<uint32_t> Reads;
+        std::vector<uint32_t> Writes;
+        PassFunc Func;
+        bool MainThread = false;
+
+        std::vector<uint32_t> Dependents; // Passes that wait for this one
+        uint32_t DependencyCount = 0;
+    };
+
+    uint32_t GetResource(const char *name);
+    void Compile();
+    void Launch(uint32_t pass);
+    void RunPass(uint32_t pass);
+
+    std::vector<Pass> m_Passes;
+    std::vector<std::string> m_Resources;
+    bool m_Compiled = false;
+
+    // Per-frame state
+    std::unique_ptr<std::atomic<uint32_t>[]> m_Remaining; // Unfinished dependencies of each pass
+    std::atomic<uint32_t> m_Outstanding{0};               // Passes not yet finished this frame
+    std::mutex m_MainMutex;
+    std::vector<uint32_t> m_MainReady; // Main-thread passes whose dependencies are done, in launch order
+    size_t m_MainNext = 0;             // First entry of m_MainReady not yet run; each pass is pushed once a frame
+    std::chrono::high_resolution_clock::time_point m_FrameStart;
+
+    std::vector<FrameTimelineEntry> m_Timeline; // Indexed by pass
+    float m_LastFrameMs = 0.0f;
+};
+
+} // namespace TE
@@ -0,0 +1,158 @@
+﻿#pragma once
+#include "JobTask.hpp"
+#include "SlotPool.hpp"
+#include "WorkStealingDeque.hpp"
+#include <condition_variable>
+#include <deque>
+
+enum class JobPriority {
+    High,
+    Normal,
+    Low,
+    Count
+};
+
+struct Job;
+
+// Counts unfinished jobs. Jobs submitted with a counter as their signal increment it and decrement it when they
+// finish; jobs submitted with it as their dependency are held back until it reaches zero. Do not add work to a
+// counter that still has dependents parked on it.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const {
+        return m_Pending.load(std::memory_order_acquire) == 0 && m_Finishing.load(std::memory_order_acquire) == 0;
+    }
+    uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+    friend class JobHandle;
+
+    std::atomic<uint32_t> m_References{0}; // JobHandles sharing a pooled counter
+    std::atomic<uint32_t> m_Pending{0};
+    std::atomic<uint32_t> m_Finishing{0}; // Jobs still touching the counter after their decrement
+    std::mutex m_WaitersMutex;
+    std::vector<Job*> m_Waiters;
+};
+
+// Shared reference to a pooled JobCounter; the counter goes back to the pool with the last handle
+class JobHandle {
+public:
+    JobHandle() = default;
+    JobHandle(std::nullptr_t) {}
+    JobHandle(const JobHandle& other) : m_Counter(other.m_Counter) { AddReference(); }
+    JobHandle(JobHandle&& other) noexcept : m_Counter(other.m_Counter) { other.m_Counter = nullptr; }
+    ~JobHandle() { RemoveReference(); }
+
+    JobHandle& operator=(JobHandle other) noexcept {
+        std::swap(m_Counter, other.m_Counter);
+        return *this;
+    }
+
+    static JobHandle Create();
+
+    JobCounter* Get() const { return m_Counter; }
+    JobCounter& operator*() const { return *m_Counter; }
+    JobCounter* operator->() const { return m_Counter; }
+    explicit operator bool() const { return m_Counter != nullptr; }
+
+private:
+    void AddReference() {
+        if (m_Counter)
+            m_Counter->m_References.fetch_add(1, std::memory_order_relaxed);
+    }
+    void RemoveReference();
+
+    JobCounter* m_Counter = nullptr;
+};
+
+struct Job {
+    JobTask Task;
+    JobPriority Priority = JobPriority::Normal;
+    JobCounter* Signal = nullptr;
+    JobHandle SignalOwner; // Keeps a handle's counter alive until the job has signalled it
+};
+
+// Work-stealing scheduler shared by every TaskType. Each worker owns one lock-free deque per priority class and
+// runs its own newest job first; idle workers steal the oldest job from the others, highest priority first.
+// The thread that calls Init is registered as worker 0: it never runs jobs on its own, but WaitFor and
+// ParallelFor make it execute queued work while it waits. Other threads submit through a locked injection queue.
+// Without Init, or when a deque is full, jobs fall back to the injection queue or run inline. Job slots and
+// handle counters come from SlotPools, so a job whose callable fits JobTask's inline storage is submitted and
+// run without a heap allocation.
+class JobSystem {
+public:
+    static void Init(size_t workerCount = 0); // 0 = one per hardware thread besides the caller, at least 1
+    static void Shutdown();
+    static bool IsInitialized() { return s_State != nullptr; }
+
+    // Background worker threads, not counting the thread that called Init
+    static size_t GetWorkerCount();
+
+    // The caller keeps signal and dependency alive until the job has run
+    static void Run(JobTask task, JobPriority priority = JobPriority::Normal,
+                    JobCounter* signal = nullptr, JobCounter* dependency = nullptr);
+
+    // Returns a handle that completes when the job has run; it may be passed as another job's dependency
+    static JobHandle Submit(JobTask task, JobPriority priority = JobPriority::Normal,
+                            const JobHandle& dependency = nullptr);
+
+    // Runs one queued job of at least the given priority on the calling thread, if there is any; for callers
+    // that wait on something else and must not be held up by less urgent work
+    static bool RunPendingJob(JobPriority lowest = JobPriority::Low);
+
+    // 0 for the thread that called Init, 1..GetWorkerCount() for the workers, -1 for any other thread
+    static int GetCurrentWorkerIndex() { return s_WorkerIndex; }
+
+    // Executes queued jobs on the calling thread until the counter reaches zero
+    static void WaitFor(JobCounter& counter);
+    static void WaitFor(const JobHandle& handle);
+
+    // Splits [0, count) into at most maxChunks contiguous ranges (0 = one per worker plus the caller) and calls
+    // job(begin, end, chunkIndex) for each, returning once all are done. The caller runs chunk 0 and then helps
+    // with whatever is queued. Chunk boundaries only depend on count and the chunk count.
+    static size_t ParallelFor(JobPriority priority, size_t count, size_t maxChunks, size_t minChunkSize,
+                              const std::function<void(size_t, size_t, size_t)>& job);
+
+private:
+    static constexpr size_t PriorityCount = (size_t)JobPriority::Count;
+    static constexpr size_t DequeCapacity = 4096;
+
+    struct Worker {
+        WorkStealingDeque<Job, DequeCapacity> Queues[PriorityCount];
+    };
+
+    struct State {
+        ~State();
+
+        std::vector<std::unique_ptr<Worker>> Workers; // Index 0 belongs to the thread that called Init
+        std::vector<std::thread> Threads;
+
+        std::mutex InjectionMutex;
+        std::deque<Job*> Injected[PriorityCount];
+
+        std::atomic<int64_t> Queued{0};
+        std::atomic<uint32_t> Sleeping{0};
+        std::atomic<bool> Stop{false};
+        std::mutex SleepMutex;
+        std::condition_variable WakeCondition;
+    };
+
+    static void WorkerLoop(State* state, int index);
+    static Job* CreateJob(JobTask&& task, JobPriority priority, JobCounter* signal);
+    static void Schedule(Job* job);
+    static Job* FindJob(State* state, int index, JobPriority lowest = JobPriority::Low);
+    static void Execute(Job* job);
+    static void Finish(JobCounter& counter);
+    static void Enqueue(Job* job, JobCounter* dependency);
+
+    inline static std::unique_ptr<State> s_State;
+    inline static thread_local int s_WorkerIndex = -1;
+    inline static thread_local std::vector<Job*> s_Released; // Finish's scratch list of released dependents
+};
+
+#include "JobSystem.inl"
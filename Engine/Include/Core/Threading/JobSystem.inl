@@ -0,0 +1,278 @@
+inline void JobSystem::Init(size_t workerCount) {
+    if (s_State)
+        return;
+
+    if (workerCount == 0) {
+        unsigned int total = std::thread::hardware_concurrency();
+        if (total == 0) total = 4; // fallback
+        workerCount = std::max<size_t>(total - 1, 1);
+    }
+
+    auto state = std::make_unique<State>();
+    for (size_t i = 0; i <= workerCount; ++i)
+        state->Workers.push_back(std::make_unique<Worker>());
+
+    s_WorkerIndex = 0;
+    State* raw = state.get();
+    s_State = std::move(state);
+    for (size_t i = 1; i <= workerCount; ++i)
+        raw->Threads.emplace_back(&JobSystem::WorkerLoop, raw, (int)i);
+}
+
+inline void JobSystem::Shutdown() {
+    s_State.reset();
+    s_WorkerIndex = -1;
+}
+
+inline JobSystem::State::~State() {
+    {
+        std::lock_guard lock(SleepMutex);
+        Stop = true;
+    }
+    WakeCondition.notify_all();
+    for (auto& thread : Threads)
+        thread.join();
+
+    // Nothing is stealing any more: run what is left so no counter is left waiting
+    for (size_t priority = 0; priority < PriorityCount; ++priority) {
+        for (auto& worker : Workers) {
+            while (Job* job = worker->Queues[priority].Steal())
+                Execute(job);
+        }
+        while (!Injected[priority].empty()) {
+            Job* job = Injected[priority].front();
+            Injected[priority].pop_front();
+            Execute(job);
+        }
+    }
+}
+
+inline size_t JobSystem::GetWorkerCount() {
+    return s_State ? s_State->Threads.size() : 0;
+}
+
+inline JobHandle JobHandle::Create() {
+    JobHandle handle;
+    handle.m_Counter = SlotPool<JobCounter>::Acquire();
+    handle.m_Counter->m_References.store(1, std::memory_order_relaxed);
+    return handle;
+}
+
+inline void JobHandle::RemoveReference() {
+    if (m_Counter && m_Counter->m_References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Only parked dependents could still be listed, and they hold no reference; the list keeps its capacity
+        m_Counter->m_Waiters.clear();
+        SlotPool<JobCounter>::Release(m_Counter);
+    }
+    m_Counter = nullptr;
+}
+
+inline Job* JobSystem::CreateJob(JobTask&& task, JobPriority priority, JobCounter* signal) {
+    Job* job = SlotPool<Job>::Acquire();
+    job->Task = std::move(task);
+    job->Priority = priority;
+    job->Signal = signal;
+    return job;
+}
+
+inline void JobSystem::Run(JobTask task, JobPriority priority, JobCounter* signal, JobCounter* dependency) {
+    Enqueue(CreateJob(std::move(task), priority, signal), dependency);
+}
+
+inline JobHandle JobSystem::Submit(JobTask task, JobPriority priority, const JobHandle& dependency) {
+    JobHandle handle = JobHandle::Create();
+    Job* job = CreateJob(std::move(task), priority, handle.Get());
+    job->SignalOwner = handle;
+    Enqueue(job, dependency.Get());
+    return handle;
+}
+
+inline void JobSystem::Enqueue(Job* job, JobCounter* dependency) {
+    if (job->Signal)
+        job->Signal->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+
+    if (dependency) {
+        std::lock_guard lock(dependency->m_WaitersMutex);
+        if (dependency->m_Pending.load(std::memory_order_acquire) != 0) {
+            dependency->m_Waiters.push_back(job);
+            return;
+        }
+    }
+    Schedule(job);
+}
+
+inline void JobSystem::Schedule(Job* job) {
+    State* state = s_State.get();
+    if (!state) {
+        Execute(job);
+        return;
+    }
+
+    size_t priority = (size_t)job->Priority;
+    state->Queued.fetch_add(1, std::memory_order_seq_cst);
+
+    int index = s_WorkerIndex;
+    if (index < 0 || (size_t)index >= state->Workers.size() || !state->Workers[index]->Queues[priority].Push(job)) {
+        std::lock_guard lock(state->InjectionMutex);
+        state->Injected[priority].push_back(job);
+    }
+
+    if (state->Sleeping.load(std::memory_order_seq_cst) != 0) {
+        // Taking the lock orders this wake-up after a sleeper's predicate check, so it cannot be lost
+        { std::lock_guard lock(state->SleepMutex); }
+        state->WakeCondition.notify_one();
+    }
+}
+
+inline Job* JobSystem::FindJob(State* state, int index, JobPriority lowest) {
+    size_t workerCount = state->Workers.size();
+
+    for (size_t priority = 0; priority <= (size_t)lowest; ++priority) {
+        Job* job = nullptr;
+        if (index >= 0)
+            job = state->Workers[index]->Queues[priority].Pop();
+
+        if (!job) {
+            std::lock_guard lock(state->InjectionMutex);
+            if (!state->Injected[priority].empty()) {
+                job = state->Injected[priority].front();
+                state->Injected[priority].pop_front();
+            }
+        }
+
+        // Start with the next worker so thieves spread over the victims
+        size_t start = index >= 0 ? (size_t)index + 1 : 0;
+        for (size_t i = 0; !job && i < workerCount; ++i) {
+            size_t victim = (start + i) % workerCount;
+            if ((int)victim != index)
+                job = state->Workers[victim]->Queues[priority].Steal();
+        }
+
+        if (job) {
+            state->Queued.fetch_sub(1, std::memory_order_seq_cst);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+inline void JobSystem::Execute(Job* job) {
+    job->Task();
+    if (job->Signal)
+        Finish(*job->Signal);
+
+    job->Task.Reset();
+    job->Signal = nullptr;
+    job->SignalOwner = nullptr;
+    SlotPool<Job>::Release(job);
+}
+
+inline void JobSystem::Finish(JobCounter& counter) {
+    counter.m_Finishing.fetch_add(1, std::memory_order_seq_cst);
+    if (counter.m_Pending.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+        // Copied out into a per-thread buffer so neither list gives up its capacity. Schedule may run a job
+        // inline that finishes another counter on this thread, so each call only owns the entries it appended.
+        std::vector<Job*>& released = s_Released;
+        size_t begin = released.size();
+        {
+            std::lock_guard lock(counter.m_WaitersMutex);
+            released.insert(released.end(), counter.m_Waiters.begin(), counter.m_Waiters.end());
+            counter.m_Waiters.clear();
+        }
+        size_t end = released.size();
+        for (size_t i = begin; i < end; ++i)
+            Schedule(released[i]);
+        released.resize(begin);
+    }
+    // Last access: a waiter may destroy the counter as soon as this lands
+    counter.m_Finishing.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+inline void JobSystem::WorkerLoop(State* state, int index) {
+    s_WorkerIndex = index;
+
+    while (!state->Stop.load(std::memory_order_acquire)) {
+        if (Job* job = FindJob(state, index)) {
+            Execute(job);
+            continue;
+        }
+
+        // A job may be in flight between the counter and a deque; spin briefly before sleeping
+        bool found = false;
+        for (int spin = 0; spin < 64 && !found; ++spin) {
+            std::this_thread::yield();
+            found = state->Queued.load(std::memory_order_acquire) > 0;
+        }
+        if (found)
+            continue;
+
+        std::unique_lock lock(state->SleepMutex);
+        state->Sleeping.fetch_add(1, std::memory_order_seq_cst);
+        state->WakeCondition.wait(lock, [state] {
+            return state->Stop.load() || state->Queued.load(std::memory_order_seq_cst) > 0;
+        });
+        state->Sleeping.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+inline bool JobSystem::RunPendingJob(JobPriority lowest) {
+    State* state = s_State.get();
+    Job* job = state ? FindJob(state, s_WorkerIndex, lowest) : nullptr;
+    if (!job)
+        return false;
+    Execute(job);
+    return true;
+}
+
+inline void JobSystem::WaitFor(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!RunPendingJob())
+            std::this_thread::yield();
+    }
+}
+
+inline void JobSystem::WaitFor(const JobHandle& handle) {
+    if (handle)
+        WaitFor(*handle);
+}
+
+inline size_t JobSystem::ParallelFor(JobPriority priority, size_t count, size_t maxChunks, size_t minChunkSize,
+                                     const std::function<void(size_t, size_t, size_t)>& job) {
+    if (count == 0)
+        return 0;
+
+    size_t workers = GetWorkerCount();
+    size_t chunks = maxChunks == 0 ? workers + 1 : maxChunks;
+    chunks = std::min(chunks, (count + std::max<size_t>(minChunkSize, 1) - 1) / std::max<size_t>(minChunkSize, 1));
+    chunks = std::max<size_t>(chunks, 1);
+
+    auto range = [count, chunks](size_t chunk, size_t& begin, size_t& end) {
+        begin = count * chunk / chunks;
+        end = count * (chunk + 1) / chunks;
+    };
+
+    if (chunks == 1 || workers == 0) {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            size_t begin, end;
+            range(chunk, begin, end);
+            job(begin, end, chunk);
+        }
+        return chunks;
+    }
+
+    JobCounter remaining;
+    for (size_t chunk = 1; chunk < chunks; ++chunk) {
+        Run([&job, &range, chunk] {
+            size_t begin, end;
+            range(chunk, begin, end);
+            job(begin, end, chunk);
+        }, priority, &remaining);
+    }
+
+    size_t begin, end;
+    range(0, begin, end);
+    job(begin, end, 0);
+
+    WaitFor(remaining);
+    return chunks;
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+#include "Core/PreRequisites.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+// Move-only void() callable for the job system. Callables up to InlineSize bytes are stored in place, so
+// submitting a lambda with a few captures never touches the heap; larger ones fall back to a heap copy.
+class JobTask {
+public:
+    static constexpr size_t InlineSize = 64;
+
+    JobTask() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, JobTask>>>
+    JobTask(F&& function) {
+        using Callable = std::decay_t<F>;
+        if constexpr (FitsInline<Callable>()) {
+            new (m_Storage) Callable(std::forward<F>(function));
+            m_Ops = &InlineOps<Callable>;
+        } else {
+            *reinterpret_cast<Callable**>(m_Storage) = new Callable(std::forward<F>(function));
+            m_Ops = &HeapOps<Callable>;
+        }
+    }
+
+    JobTask(JobTask&& other) noexcept { MoveFrom(other); }
+
+    JobTask& operator=(JobTask&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    JobTask(const JobTask&) = delete;
+    JobTask& operator=(const JobTask&) = delete;
+
+    ~JobTask() { Reset(); }
+
+    void operator()() { m_Ops->Invoke(m_Storage); }
+    explicit operator bool() const { return m_Ops != nullptr; }
+    bool IsInline() const { return m_Ops && m_Ops->Inline; }
+
+    void Reset() {
+        if (m_Ops) {
+            m_Ops->Destroy(m_Storage);
+            m_Ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        void (*Invoke)(void* storage);
+        void (*Move)(void* destination, void* source); // Leaves source destroyed
+        void (*Destroy)(void* storage);
+        bool Inline;
+    };
+
+    template <typename Callable>
+    static constexpr bool FitsInline() {
+        return sizeof(Callable) <= InlineSize && alignof(Callable) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+    template <typename Callable>
+    inline static const Ops InlineOps = {
+        [](void* storage) { (*static_cast<Callable*>(storage))(); },
+        [](void* destination, void* source) {
+            new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+            static_cast<Callable*>(source)->~Callable();
+        },
+        [](void* storage) { static_cast<Callable*>(storage)->~Callable(); },
+        true
+    };
+
+    template <typename Callable>
+    inline static const Ops HeapOps = {
+        [](void* storage) { (**static_cast<Callable**>(storage))(); },
+        [](void* destination, void* source) {
+            *static_cast<Callable**>(destination) = *static_cast<Callable**>(source);
+        },
+        [](void* storage) { delete *static_cast<Callable**>(storage); },
+        false
+    };
+
+    void MoveFrom(JobTask& other) {
+        if (other.m_Ops) {
+            other.m_Ops->Move(m_Storage, other.m_Storage);
+            m_Ops = other.m_Ops;
+            other.m_Ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_Storage[InlineSize];
+    const Ops* m_Ops = nullptr;
+};
@@ -0,0 +1,106 @@
+﻿#pragma once
+#include "Core/PreRequisites.h"
+
+// Recycles objects of one type so that steady-state acquire/release never touches the heap. Slots are allocated
+// in blocks of BlockSize and never freed. Each thread keeps up to 2 * CacheSize free slots of its own and only
+// takes the shared lock to refill an empty cache or hand back a full one, which keeps producer/consumer splits
+// (one thread acquiring, the workers releasing) balanced. Released objects must be reset by the caller.
+template <typename T, size_t BlockSize = 256, size_t CacheSize = 64>
+class SlotPool {
+public:
+    static T* Acquire();
+    static void Release(T* slot);
+
+    // Slots ever allocated, free or not
+    static size_t GetCapacity();
+
+private:
+    struct Shared {
+        std::mutex Mutex;
+        std::vector<T*> Free;
+        std::vector<std::unique_ptr<T[]>> Blocks;
+        size_t Capacity = 0;
+    };
+
+    struct Cache {
+        Cache() { Slots.reserve(CacheSize * 2); }
+        ~Cache() {
+            s_CacheDestroyed = true;
+            std::lock_guard lock(GetShared().Mutex);
+            GetShared().Free.insert(GetShared().Free.end(), Slots.begin(), Slots.end());
+        }
+
+        std::vector<T*> Slots;
+    };
+
+    // Never destroyed: worker threads may hand slots back during static destruction
+    static Shared& GetShared() {
+        static Shared* shared = new Shared;
+        return *shared;
+    }
+
+    inline static thread_local Cache s_Cache;
+    inline static thread_local bool s_CacheDestroyed = false; // Set once thread exit has torn s_Cache down
+};
+
+template <typename T, size_t BlockSize, size_t CacheSize>
+inline T* SlotPool<T, BlockSize, CacheSize>::Acquire() {
+    if (s_CacheDestroyed) {
+        Shared& shared = GetShared();
+        std::lock_guard lock(shared.Mutex);
+        if (!shared.Free.empty()) {
+            T* slot = shared.Free.back();
+            shared.Free.pop_back();
+            return slot;
+        }
+        shared.Blocks.push_back(std::make_unique<T[]>(1));
+        ++shared.Capacity;
+        return shared.Blocks.back().get();
+    }
+
+    std::vector<T*>& cache = s_Cache.Slots;
+    if (cache.empty()) {
+        Shared& shared = GetShared();
+        std::lock_guard lock(shared.Mutex);
+        if (shared.Free.size() < CacheSize) {
+            shared.Blocks.push_back(std::make_unique<T[]>(BlockSize));
+            shared.Capacity += BlockSize;
+            T* block = shared.Blocks.back().get();
+            for (size_t i = BlockSize; i-- > 0;)
+                shared.Free.push_back(block + i);
+        }
+        size_t take = std::min(CacheSize, shared.Free.size());
+        cache.insert(cache.end(), shared.Free.end() - take, shared.Free.end());
+        shared.Free.resize(shared.Free.size() - take);
+    }
+
+    T* slot = cache.back();
+    cache.pop_back();
+    return slot;
+}
+
+template <typename T, size_t BlockSize, size_t CacheSize>
+inline void SlotPool<T, BlockSize, CacheSize>::Release(T* slot) {
+    if (s_CacheDestroyed) {
+        Shared& shared = GetShared();
+        std::lock_guard lock(shared.Mutex);
+        shared.Free.push_back(slot);
+        return;
+    }
+
+    std::vector<T*>& cache = s_Cache.Slots;
+    if (cache.size() >= CacheSize * 2) {
+        Shared& shared = GetShared();
+        std::lock_guard lock(shared.Mutex);
+        shared.Free.insert(shared.Free.end(), cache.end() - CacheSize, cache.end());
+        cache.resize(cache.size() - CacheSize);
+    }
+    cache.push_back(slot);
+}
+
+template <typename T, size_t BlockSize, size_t CacheSize>
+inline size_t SlotPool<T, BlockSize, CacheSize>::GetCapacity() {
+    Shared& shared = GetShared();
+    std::lock_guard lock(shared.Mutex);
+    return shared.Capacity;
+}
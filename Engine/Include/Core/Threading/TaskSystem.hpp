@@ -1,7 +1,6 @@
 ﻿#pragma once
-#include "ThreadPool.hpp"
-#include <unordered_map>
-#include <memory>
+#include "JobSystem.hpp"
+#include <array>
 
 enum class TaskType {
     MAIN,
@@ -12,12 +11,28 @@ enum class TaskType {
     WIDGET
 };
 
+// Every TaskType shares the JobSystem workers; the type only picks the priority class its jobs are queued under
+// (RENDER and GAMEPLAY high, CALC normal, AI and WIDGET low). MAIN runs jobs inline on the submitting thread.
 class TaskSystem {
 public:
-    static void Submit(TaskType type, const std::function<void()>& job);
+    // Returns a handle to wait on or to pass as a dependency; null when the type is disabled
+    static JobHandle Submit(TaskType type, JobTask job, const JobHandle& dependency = nullptr);
+    static void Wait(const JobHandle& handle);
     static void SetThreadEnabled(TaskType type, bool enabled);
     static void RestartThread(TaskType type);
 
+    static JobPriority GetPriority(TaskType type);
+
+    // Worker threads the type's jobs can run on, 0 when it is disabled
+    static size_t GetThreadCount(TaskType type);
+
+    // Splits [0, count) into at most maxChunks contiguous ranges (0 = one per worker plus the caller) and calls
+    // job(begin, end, chunkIndex) for each, blocking until all are done. Chunk boundaries only depend on count
+    // and the chunk count, so callers can merge per-chunk results deterministically. Runs inline when the type
+    // is disabled.
+    static size_t ParallelFor(TaskType type, size_t count, size_t maxChunks, size_t minChunkSize,
+                              const std::function<void(size_t, size_t, size_t)>& job);
+
     // Initialization
     static void InitMainThread();
     static void InitRenderThread();
@@ -27,8 +42,9 @@ public:
     static void InitWidgetThread();
 
 private:
-    inline static std::unordered_map<TaskType, std::unique_ptr<ThreadPool>> threadPools;
-    inline static std::unordered_map<TaskType, bool> threadEnabled;
+    static void Enable(TaskType type);
+
+    inline static std::array<std::atomic<bool>, 6> threadEnabled{};
 };
 
 #include "TaskSystem.inl"
@@ -1,81 +1,90 @@
-inline size_t GetThreadCountForPercentage(float percentage) {
-    unsigned int total = std::thread::hardware_concurrency();
-    if (total == 0) total = 4; // fallback
-    size_t count = static_cast<size_t>((total * percentage) / 100.0f);
-    return count > 0 ? count : 1;
+inline void TaskSystem::Enable(TaskType type) {
+    if (type != TaskType::MAIN)
+        JobSystem::Init();
+    threadEnabled[(size_t)type] = true;
 }
 
 inline void TaskSystem::InitMainThread() {
-    threadEnabled[TaskType::MAIN] = true;
+    Enable(TaskType::MAIN);
 }
 
 inline void TaskSystem::InitRenderThread() {
-    threadEnabled[TaskType::RENDER] = true;
-    threadPools[TaskType::RENDER] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(30.0f));
+    Enable(TaskType::RENDER);
 }
 
 inline void TaskSystem::InitGameplayThread() {
-    threadEnabled[TaskType::GAMEPLAY] = true;
-    threadPools[TaskType::GAMEPLAY] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(3.0f));
+    Enable(TaskType::GAMEPLAY);
 }
 
 inline void TaskSystem::InitAIThread() {
-    threadEnabled[TaskType::AI] = true;
-    threadPools[TaskType::AI] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(10.0f));
+    Enable(TaskType::AI);
 }
 
 inline void TaskSystem::InitCalcThread() {
-    threadEnabled[TaskType::CALC] = true;
-    threadPools[TaskType::CALC] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(2.0f));
+    Enable(TaskType::CALC);
 }
 
 inline void TaskSystem::InitWidgetThread() {
-    threadEnabled[TaskType::WIDGET] = true;
-    threadPools[TaskType::WIDGET] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(5.0f));
+    Enable(TaskType::WIDGET);
 }
 
 inline void TaskSystem::SetThreadEnabled(TaskType type, bool enabled) {
-    threadEnabled[type] = enabled;
+    threadEnabled[(size_t)type] = enabled;
 }
 
 inline void TaskSystem::RestartThread(TaskType type) {
-    if (type == TaskType::MAIN) return;
-
-    if (threadPools.find(type) != threadPools.end())
-        threadPools[type].reset();
+    // Types no longer own threads; restarting only brings the shared workers up if they are gone
+    Enable(type);
+}
 
+inline JobPriority TaskSystem::GetPriority(TaskType type) {
     switch (type) {
+        case TaskType::MAIN:
         case TaskType::RENDER:
-            threadPools[type] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(30.0f));
-            break;
         case TaskType::GAMEPLAY:
-            threadPools[type] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(3.0f));
-            break;
-        case TaskType::AI:
-            threadPools[type] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(10.0f));
-            break;
+            return JobPriority::High;
         case TaskType::CALC:
-            threadPools[type] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(2.0f));
-            break;
+            return JobPriority::Normal;
+        case TaskType::AI:
         case TaskType::WIDGET:
-            threadPools[type] = std::make_unique<ThreadPool>(GetThreadCountForPercentage(5.0f));
-            break;
         default:
-            break;
+            return JobPriority::Low;
     }
-
-    threadEnabled[type] = true;
 }
 
-inline void TaskSystem::Submit(TaskType type, const std::function<void()>& job) {
-    if (!threadEnabled[type]) return;
+inline JobHandle TaskSystem::Submit(TaskType type, JobTask job, const JobHandle& dependency) {
+    if (!threadEnabled[(size_t)type]) return nullptr;
 
     if (type == TaskType::MAIN) {
+        Wait(dependency);
         job();
-        return;
+        return JobHandle::Create();
     }
 
-    auto it = threadPools.find(type);
-    if (it != threadPools.end() && it->second)
-        it->second->Enqueue(job);
+    return JobSystem::Submit(std::move(job), GetPriority(type), dependency);
+}
+
+inline void TaskSystem::Wait(const JobHandle& handle) {
+    JobSystem::WaitFor(handle);
+}
+
+inline size_t TaskSystem::GetThreadCount(TaskType type) {
+    if (type == TaskType::MAIN || !threadEnabled[(size_t)type])
+        return 0;
+    return JobSystem::GetWorkerCount();
+}
+
+inline size_t TaskSystem::ParallelFor(TaskType type, size_t count, size_t maxChunks, size_t minChunkSize,
+                                      const std::function<void(size_t, size_t, size_t)>& job) {
+    if (GetThreadCount(type) == 0) {
+        if (count == 0)
+            return 0;
+        size_t chunks = std::max<size_t>(maxChunks, 1);
+        chunks = std::min(chunks, (count + std::max<size_t>(minChunkSize, 1) - 1) / std::max<size_t>(minChunkSize, 1));
+        chunks = std::max<size_t>(chunks, 1);
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+            job(count * chunk / chunks, count * (chunk + 1) / chunks, chunk);
+        return chunks;
+    }
+    return JobSystem::ParallelFor(GetPriority(type), count, maxChunks, minChunkSize, job);
 }
@@ -14,12 +14,13 @@
 #define DISABLE_THREAD(type)   TaskSystem::SetThreadEnabled(TaskType::type, false)
 
 // === SUBMIT JOB MACROS ===
-#define SUBMIT_MAIN(job)       TaskSystem::Submit(TaskType::MAIN, job)
-#define SUBMIT_RENDER(job)     TaskSystem::Submit(TaskType::RENDER, job)
-#define SUBMIT_GAMEPLAY(job)   TaskSystem::Submit(TaskType::GAMEPLAY, job)
-#define SUBMIT_AI(job)         TaskSystem::Submit(TaskType::AI, job)
-#define SUBMIT_CALC(job)       TaskSystem::Submit(TaskType::CALC, job)
-#define SUBMIT_WIDGET(job)     TaskSystem::Submit(TaskType::WIDGET, job)
+// Variadic so lambdas with several captures pass through; an optional second argument is a JobHandle dependency
+#define SUBMIT_MAIN(...)      TaskSystem::Submit(TaskType::MAIN, __VA_ARGS__)
+#define SUBMIT_RENDER(...)    TaskSystem::Submit(TaskType::RENDER, __VA_ARGS__)
+#define SUBMIT_GAMEPLAY(...)  TaskSystem::Submit(TaskType::GAMEPLAY, __VA_ARGS__)
+#define SUBMIT_AI(...)        TaskSystem::Submit(TaskType::AI, __VA_ARGS__)
+#define SUBMIT_CALC(...)      TaskSystem::Submit(TaskType::CALC, __VA_ARGS__)
+#define SUBMIT_WIDGET(...)    TaskSystem::Submit(TaskType::WIDGET, __VA_ARGS__)
 
 // === RESTART MACRO ===
 #define RESTART_THREAD(type)   TaskSystem::RestartThread(TaskType::type)
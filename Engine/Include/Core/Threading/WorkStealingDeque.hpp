@@ -0,0 +1,87 @@
+﻿#pragma once
+#include "Core/PreRequisites.h"
+#include <cstdint>
+
+// Fixed-capacity Chase-Lev deque. The owning thread pushes and pops at the bottom; any thread may steal from the
+// top. Capacity must be a power of two. Push fails rather than growing, so the caller decides what to do on
+// overflow and no slot is ever reallocated under a concurrent thief.
+template <typename T, size_t Capacity>
+class WorkStealingDeque {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    WorkStealingDeque() {
+        for (auto& slot : m_Slots)
+            slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    bool Push(T* item);
+    T* Pop();
+
+    // Any thread
+    T* Steal();
+
+    bool Empty() const {
+        return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t Mask = (int64_t)Capacity - 1;
+
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) std::atomic<T*> m_Slots[Capacity];
+};
+
+template <typename T, size_t Capacity>
+inline bool WorkStealingDeque<T, Capacity>::Push(T* item) {
+    int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+    int64_t top = m_Top.load(std::memory_order_acquire);
+    if (bottom - top >= (int64_t)Capacity)
+        return false;
+
+    m_Slots[bottom & Mask].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+inline T* WorkStealingDeque<T, Capacity>::Pop() {
+    int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+    m_Bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_Top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    T* item = m_Slots[bottom & Mask].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // Last item: race the thieves for it
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            item = nullptr;
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return item;
+}
+
+template <typename T, size_t Capacity>
+inline T* WorkStealingDeque<T, Capacity>::Steal() {
+    int64_t top = m_Top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+        return nullptr;
+
+    T* item = m_Slots[top & Mask].load(std::memory_order_relaxed);
+    if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+    return item;
+}
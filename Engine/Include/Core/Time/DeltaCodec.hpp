@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace TE
+{
+
+// Delta compression shared by the rewind buffers (TimeRecorder, PhysicsStateHistory). A delta turns one
+// snapshot into the next one of the same size: the two are XORed, and the zero runs left by unchanged bytes
+// are run-length encoded. Nothing is allocated; the caller owns every buffer.
+class DeltaCodec
+{
+public:
+    // Upper bound of Encode's output for a size byte snapshot
+    static size_t MaxEncodedSize(size_t size);
+
+    // Writes the delta from base to state, both size bytes, into out and returns its length
+    static size_t Encode(const uint8_t *base, const uint8_t *state, size_t size, uint8_t *out);
+
+    // Turns the base into the state in place; false if the delta is corrupt or was made for another size
+    static bool Apply(uint8_t *state, size_t size, const uint8_t *delta, size_t deltaSize);
+};
+
+} // namespace TE
@@ -0,0 +1,118 @@
+#pragma once
+#include "Core/PreRequisites.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace TE
+{
+class EntityManager;
+class PhysicsWorld;
+
+// Records the state of tracked component types once per fixed tick into a preallocated ring buffer, so the
+// scene can be scrubbed back in time. A frame holds, for every instance of every tracked type, its transform
+// and its trivially copyable member properties (PropertyMetadata::AddressFunc), followed by the attached
+// PhysicsWorld's CaptureState snapshot. Every KeyframeInterval-th frame is stored whole; the others as a
+// DeltaCodec delta against the frame before them.
+// Restoring writes the values back into components that still exist; entities and components created or
+// destroyed since are left alone. Scrubbing restores the components only; the physics snapshot goes through
+// PhysicsWorld::RestoreState, which rebuilds the Velox world, when Rewind resumes from a frame. Component
+// recording and restoring do not allocate once the scratch buffers have grown to the size of the scene.
+class TE_API TimeRecorder
+{
+public:
+    explicit TimeRecorder(EntityManager &entityManager, size_t budgetBytes = 16 * 1024 * 1024,
+                          float historySeconds = 10.0f, float tickRate = 60.0f, size_t keyframeInterval = 60);
+
+    // Records every component registered under the class name. Changes the frame layout, so clears the history.
+    bool Track(const std::string &className);
+    void TrackAllRegistered();
+
+    // Records and restores the world's rigid bodies with the components; nullptr detaches it. A world with soft
+    // bodies cannot be snapshot, so frames recorded while it has any leave it untouched on restore. Changes
+    // the frame layout, so clears the history.
+    void SetPhysicsWorld(PhysicsWorld *world);
+
+    // Records one frame per elapsed fixed tick, at most 4 per call; returns the number recorded
+    int Update(float deltaTime);
+    bool Record();
+
+    // Restores the frame recorded the given time ago, clamped to the oldest one. Scrub keeps the newer frames
+    // so the caller can scrub forward again and leaves the physics world as it is; Rewind also restores the
+    // physics and drops the newer frames so recording branches off the restored frame.
+    bool Scrub(float secondsAgo);
+    bool Rewind(float secondsAgo);
+    void Clear();
+
+    size_t GetFrameCount() const { return m_Count; }
+    float GetTickRate() const { return m_TickRate; }
+    float GetRecordedSeconds() const { return (float)m_Count / m_TickRate; }
+    size_t GetBytesUsed() const { return m_BytesUsed; }
+    size_t GetBudgetBytes() const { return m_Arena.size(); }
+    float GetMemoryPerSecond() const;
+    float GetLastRecordMs() const { return m_LastRecordMs; }
+    float GetLastRestoreMs() const { return m_LastRestoreMs; }
+
+private:
+    struct Field
+    {
+        std::function<void *(void *)> Address;
+        size_t Size = 0;
+    };
+
+    struct TrackedType
+    {
+        std::string ClassName;
+        std::type_index Type;
+        std::vector<Field> Fields;
+        size_t InstanceSize = 0; // Transform plus every field
+    };
+
+    struct Frame
+    {
+        size_t Offset = 0;
+        size_t Size = 0;
+        bool Keyframe = false;
+    };
+
+    const Frame &GetFrame(size_t index) const { return m_Frames[(m_First + index) % m_Frames.size()]; }
+    size_t AgeFromSeconds(float secondsAgo) const;
+    bool Restore(size_t age, bool restorePhysics);
+    void Capture();
+    void Apply(const std::vector<uint8_t> &state, bool restorePhysics);
+    // Reserves arena space for a frame, evicting the oldest frames it would overwrite
+    bool Allocate(size_t size, size_t &outOffset);
+    void EvictOldest();
+    void ReportStats() const;
+
+    EntityManager &m_EntityManager;
+    std::vector<TrackedType> m_Types;
+    PhysicsWorld *m_PhysicsWorld = nullptr;
+
+    std::vector<uint8_t> m_Arena; // Frame payloads, written front to back and wrapping
+    std::vector<Frame> m_Frames;  // Ring of frame headers, oldest at m_First
+    size_t m_First = 0;
+    size_t m_Count = 0;
+    size_t m_WriteOffset = 0;
+    size_t m_BytesUsed = 0;
+    size_t m_KeyframeInterval;
+    size_t m_SinceKeyframe = 0;
+
+    float m_TickRate;
+    float m_Accumulator = 0.0f;
+
+    // Scratch, reused from frame to frame
+    std::vector<uint8_t> m_Current;
+    std::vector<uint8_t> m_Previous; // Newest recorded frame in full, the base of the next delta
+    std::vector<uint8_t> m_Encoded;
+    std::vector<uint8_t> m_Restored;
+    std::vector<uint8_t> m_PhysicsState;
+
+    float m_LastRecordMs = 0.0f;
+    float m_LastRestoreMs = 0.0f;
+};
+
+} // namespace TE
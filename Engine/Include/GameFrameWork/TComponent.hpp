@@ -3,6 +3,7 @@
 #include "Utils/MathUtils.hpp"
 #include "Utils/TimeGUI.hpp"
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,6 +15,21 @@ namespace TE
 class Renderer2D;
 class Material;
 
+/// Parameters a component's occlusion outline depends on besides its world transform
+struct OcclusionShape
+{
+    static constexpr uint32_t MaxParams = 8;
+
+    float Params[MaxParams] = {};
+    uint32_t Count = 0;
+
+    bool operator==(const OcclusionShape &other) const
+    {
+        return Count == other.Count && std::equal(Params, Params + Count, other.Params);
+    }
+    bool operator!=(const OcclusionShape &other) const { return !(*this == other); }
+};
+
 TE_CLASS()
 class TE_API TComponent
 {
@@ -73,6 +89,10 @@ public:
     /// Returns true if this component should block light (for shadow casting).
     virtual bool CastsOcclusionShadow() const { return false; }
 
+    /// Reports the parameters GetWorldVertices depends on besides the world transform, so cached shadow
+    /// geometry is only rebuilt when one of them changes. Returning false rebuilds it every frame.
+    virtual bool GetOcclusionShape(OcclusionShape &outShape) const { return false; }
+
     /// Renders the component specifically for the editor/scene view.
     virtual void OnRender(class TE::Renderer2D *renderer, const TE::TEMatrix4 &worldModel,
                           const std::shared_ptr<class TE::Material> &material) const
@@ -103,9 +123,15 @@ public:
         {
             Parent->Children.push_back(this);
         }
+
+        NotifyHierarchyChanged();
     }
 
     static constexpr const char *StaticClassName = "TComponent";
+
+private:
+    // Lets the owning EntityManager invalidate structures built from the component hierarchy
+    void NotifyHierarchyChanged();
 };
 
 } // namespace TE
@@ -4,13 +4,16 @@
 #include "Core/Events/KeyEvent.h"
 #include "Core/Events/MouseEvent.h"
 #include "Core/Scene/Scene.hpp"
+#include "Core/Threading/FrameGraph.hpp"
 #include "Layers/Layer.hpp"
 #include "Renderer/Framebuffer.hpp"
 #include "Renderer/GraphicsAPI.hpp"
+#include "Renderer/ShadowOccluderGrid.hpp"
 #include <filesystem>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TE
@@ -85,6 +88,7 @@ private:
     void SaveScene();
     void SaveProject();
     void LoadScene(const std::filesystem::path &filepath);
+    void ResetTimeRecorder();
     void UI_DrawSaveScenePopup();
 
     // Gizmo Helpers
@@ -104,11 +108,20 @@ private:
     void UI_DrawSettingsPanel();
     void UI_DrawProjectSettingsPanel();
     void UI_DrawPluginsPanel();
+    void UI_DrawRewindPanel();
     void UI_DrawGizmoText();
     void UI_ViewportContextMenu();
     void DrawComponentNode(Entity entity, class TComponent *comp);
     std::string GetKeyName(KeyCode key);
 
+    // Frame passes, scheduled by m_FrameGraph
+    void BuildFrameGraph();
+    bool IsLightMapEnabled() const;
+    void CollectSceneLights();
+    void UpdateShadowOccluders();
+    void RenderLightMap();
+    void RenderScene();
+
     // Navigation
     void UpdateCamera(float dt);
     void HandleViewportInput();
@@ -128,6 +141,7 @@ private:
     char m_SaveScenePathBuffer[256] = "";
     class ProfilingLayer *m_ProfilingLayer = nullptr;
     bool m_ShowConsolePanel = true;
+    bool m_ShowRewindPanel = false;
 
     // Terminal/Console State
     char m_TerminalInputBuffer[256] = "";
@@ -204,9 +218,45 @@ private:
     std::shared_ptr<class Framebuffer> m_LightMapFramebuffer;
     std::shared_ptr<class Renderer2D> m_Renderer2D;
 
+    // Lightmap shadow casters, cached across frames and rebuilt only when their world geometry changes
+    struct CachedOccluder
+    {
+        TEMatrix4 Model;
+        OcclusionShape Shape;
+        bool HasShape = false;
+        uint32_t Slot = 0; // Index into m_ShadowOccluders
+        uint64_t LastFrame = 0;
+    };
+    std::unordered_map<const class TComponent *, CachedOccluder> m_OccluderCache;
+    std::vector<ShadowOccluder> m_ShadowOccluders;
+    std::vector<const class TComponent *> m_ShadowOccluderOwners; // Parallel to m_ShadowOccluders
+    ShadowOccluderGrid m_ShadowOccluderGrid;
+    std::vector<uint32_t> m_VisibleOccluders;
+    uint64_t m_LightMapFrame = 0;
+
+    // Per-frame pass outputs
+    struct SceneLight
+    {
+        TEVector2 pos;
+        float radius;
+        float rotation;
+        class LightComponent *comp;
+    };
+    std::vector<SceneLight> m_SceneLights;
+    const class AmbientLightComponent *m_FrameAmbient = nullptr;
+
+    FrameGraph m_FrameGraph;
+    float m_FrameDeltaTime = 0.0f;
+
     // Physics
     std::shared_ptr<class PhysicsWorld> m_PhysicsWorld;
     std::vector<struct RigidBody *> m_TestBodies;
+
+    // Rewind history of the active scene and the physics world, recreated along with the scene. Only exists
+    // while recording is on; physics and recording pause while the Rewind panel is scrubbed into the past.
+    std::unique_ptr<class TimeRecorder> m_TimeRecorder;
+    bool m_RecordRewind = false;
+    float m_RewindSecondsAgo = 0.0f;
     std::shared_ptr<class Material> m_DebugMaterial;
     std::shared_ptr<class Material> m_LightBlendMaterial;
     std::shared_ptr<class Material> m_GizmoXMaterial;
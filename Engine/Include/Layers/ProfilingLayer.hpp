@@ -1,8 +1,10 @@
 #pragma once
+#include "Core/Threading/FrameGraph.hpp"
 #include "Layers/Layer.hpp"
 #include "Utils/TimeGUI.hpp"
 #include <chrono>
 #include <deque>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -37,6 +39,9 @@ struct PerformanceMetrics
     uint32_t vertices = 0;
     uint32_t textures = 0;
     uint32_t shaders = 0;
+    uint32_t shaderBinds = 0;
+    uint32_t materialBinds = 0;
+    uint32_t blendChanges = 0;
     float gpuMemory = 0.0f;
     float vramUsage = 0.0f;
 
@@ -45,6 +50,11 @@ struct PerformanceMetrics
     float renderTime = 0.0f;
     float physicsTime = 0.0f;
     float uiTime = 0.0f;
+
+    // Rewind history (TimeRecorder)
+    float rewindSeconds = 0.0f;
+    float rewindBytesPerSecond = 0.0f;
+    float rewindRestoreTime = 0.0f; // ms, last restore
 };
 
 class ProfilingLayer : public Layer
@@ -69,12 +79,24 @@ public:
     void RecordVertex(uint32_t count);
     void RecordTexture(uint32_t count);
     void RecordShader(uint32_t count);
+    void RecordStateChanges(uint32_t shaderBinds, uint32_t materialBinds, uint32_t blendChanges);
 
     // ===== Timing Registration =====
     void RecordGameTime(float ms) { m_CurrentMetrics.gameTime = ms; }
     void RecordRenderTime(float ms) { m_CurrentMetrics.renderTime = ms; }
     void RecordPhysicsTime(float ms) { m_CurrentMetrics.physicsTime = ms; }
     void RecordUITime(float ms) { m_CurrentMetrics.uiTime = ms; }
+    void RecordRewindStats(float seconds, float bytesPerSecond, float restoreMs)
+    {
+        m_CurrentMetrics.rewindSeconds = seconds;
+        m_CurrentMetrics.rewindBytesPerSecond = bytesPerSecond;
+        m_CurrentMetrics.rewindRestoreTime = restoreMs;
+    }
+    void RecordFrameTimeline(const std::vector<FrameTimelineEntry> &timeline, float frameMs)
+    {
+        m_FrameTimeline = timeline;
+        m_FrameTimelineMs = frameMs;
+    }
 
     // ===== System Info =====
     void UpdateSystemMetrics();
@@ -125,12 +147,17 @@ private:
     std::deque<float> m_RAMHistory;
     std::deque<float> m_GPUHistory;
 
-    // Memory Allocations Tracking
+    // Memory Allocations Tracking; the static trackers may be called from job threads
+    std::mutex m_TrackingMutex;
     std::unordered_map<std::string, MemoryAllocation> m_ClassAllocations;
     std::unordered_map<std::string, size_t> m_ActiveStackFrames;
     std::deque<float> m_HeapHistory;
     std::deque<float> m_StackHistory;
 
+    // Last frame graph run, one entry per pass
+    std::vector<FrameTimelineEntry> m_FrameTimeline;
+    float m_FrameTimelineMs = 0.0f;
+
     // ===== Timing =====
     std::chrono::high_resolution_clock::time_point m_LastFrameTime;
     std::chrono::high_resolution_clock::time_point m_LastUpdateTime;
@@ -176,6 +203,7 @@ private:
     void RenderSystemInfo();
     void RenderRenderingInfo();
     void RenderMemoryInfo();
+    void RenderFrameTimeline();
     void RenderPerformanceGraphs();
     void RenderGraph(const std::string &title, const std::deque<float> &data, const TEVector4 &color,
                      float minValue = 0.0f, float maxValue = 100.0f);
@@ -20,6 +20,8 @@ public:
 
     virtual void AddVertexBuffer(VertexBuffer *vertexBuffer) override;
     virtual void SetIndexBuffer(IndexBuffer *indexBuffer) override;
+    virtual void AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                   const std::vector<uint32_t> &componentCounts) override;
 
     // GetRendererID() returns 0 — D3D11 has no VAO IDs.
     // DrawIndexed is driven by the DeviceContext, not an integer handle.
@@ -28,6 +30,7 @@ public:
 private:
     VertexBuffer *m_VertexBuffer = nullptr;
     IndexBuffer *m_IndexBuffer = nullptr;
+    VertexBuffer *m_InstanceBuffer = nullptr;
     ID3D11InputLayout *m_InputLayout = nullptr;
 };
 
@@ -5,6 +5,7 @@
 #include "Renderer/TEColor.hpp"
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <vector>
 
 namespace TE
 {
@@ -28,8 +29,18 @@ public:
     void SetShader(const std::shared_ptr<Shader> &shader);
     std::shared_ptr<Shader> GetShader() const;
 
+    // Unique per material for the lifetime of the process; used in render sort keys
+    uint32_t GetMaterialID() const { return m_MaterialID; }
+
     // Set all uniforms (for now, just color and custom ones)
     void ApplyUniforms();
+    // Same, but targeting another program (e.g. the shader's instanced variant)
+    void ApplyUniforms(Shader *shader);
+
+    // Whether any uniform besides the color exists in shader, and whether two materials upload the same values
+    // to it apart from the color. Batches that carry the color per instance use these to share one draw.
+    bool HasUniforms(Shader *shader);
+    bool HasSameUniforms(Material &other, Shader *shader);
 
     // Asset Interface
     virtual AssetHandle GetHandle() const override { return m_Handle; }
@@ -55,8 +66,29 @@ public:
     void SetHandle(AssetHandle handle) { m_Handle = handle; }
 
 private:
+    template <typename T> struct ResolvedUniform
+    {
+        UniformHandle Handle;
+        const T *Value; // Points into the matching map; map nodes never move
+    };
+
+    // The uniform maps resolved against one shader. Uniforms the shader does not have are dropped here.
+    struct ResolvedUniforms
+    {
+        uint32_t ShaderID = 0;
+        std::vector<ResolvedUniform<float>> Floats;
+        std::vector<ResolvedUniform<int>> Ints;
+        std::vector<ResolvedUniform<glm::vec2>> Vec2s;
+        std::vector<ResolvedUniform<glm::vec3>> Vec3s;
+        std::vector<ResolvedUniform<glm::vec4>> Vec4s;
+        std::vector<ResolvedUniform<glm::mat4>> Mat4s;
+    };
+
+    const ResolvedUniforms &ResolveUniforms(Shader *shader);
+
     std::shared_ptr<Shader> m_Shader;
     TEColor m_Color;
+    uint32_t m_MaterialID = 0;
 
     std::unordered_map<std::string, float> m_FloatUniforms;
     std::unordered_map<std::string, int> m_IntUniforms;
@@ -65,6 +97,10 @@ private:
     std::unordered_map<std::string, glm::vec4> m_Vec4Uniforms;
     std::unordered_map<std::string, glm::mat4> m_Mat4Uniforms;
 
+    // One entry per shader this material has been applied to (usually the shader and its instanced variant).
+    // Cleared whenever a new uniform name is added.
+    std::vector<ResolvedUniforms> m_ResolvedUniforms;
+
     AssetHandle m_Handle = 0;
     std::string m_Name = "Unnamed Material";
 };
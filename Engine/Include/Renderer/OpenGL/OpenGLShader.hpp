@@ -1,5 +1,6 @@
 #pragma once
 #include "Renderer/Shader.hpp"
+#include <unordered_map>
 
 namespace TE
 {
@@ -20,11 +21,24 @@ public:
     virtual void SetUniform1f(const std::string &name, float value) override;
     virtual void SetUniform1i(const std::string &name, int value) override;
 
+    virtual UniformHandle GetUniformHandle(const std::string &name) override;
+    virtual void SetUniformMat4(UniformHandle handle, const glm::mat4 &value) override;
+    virtual void SetUniform4f(UniformHandle handle, const glm::vec4 &value) override;
+    virtual void SetUniform3f(UniformHandle handle, const glm::vec3 &value) override;
+    virtual void SetUniform2f(UniformHandle handle, const glm::vec2 &value) override;
+    virtual void SetUniform1f(UniformHandle handle, float value) override;
+    virtual void SetUniform1i(UniformHandle handle, int value) override;
+
     // ===== OpenGL-Specific Methods =====
     uint32_t GetRendererID() const { return m_RendererID; }
+    // Served from the reflection cache; -1 if the program has no active uniform of that name
     int GetUniformLocation(const std::string &name);
 
 private:
+    // Walks the active uniforms once after link so lookups never reach the driver
+    void BuildUniformCache();
+
     uint32_t m_RendererID;
+    std::unordered_map<std::string, int> m_UniformLocations;
 };
 } // namespace TE
@@ -12,6 +12,8 @@ namespace TE {
 
         virtual void AddVertexBuffer(VertexBuffer* vertexBuffer) override;
         virtual void SetIndexBuffer(IndexBuffer* indexBuffer) override;
+        virtual void AddInstanceBuffer(VertexBuffer* vertexBuffer, uint32_t firstLocation,
+            const std::vector<uint32_t>& componentCounts) override;
         
         virtual uint32_t GetRendererID() const override { return m_RendererID; }
 
@@ -19,5 +21,6 @@ namespace TE {
         uint32_t m_RendererID;
         VertexBuffer* m_VertexBuffer;
         IndexBuffer* m_IndexBuffer;
+        VertexBuffer* m_InstanceBuffer = nullptr;
     };
 }
@@ -14,6 +14,7 @@ public:
     virtual void SetClearColor(const glm::vec4 &color) override;
     virtual void Clear() override;
     virtual void DrawIndexed(uint32_t vao, uint32_t indexCount) override;
+    virtual void DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount) override;
     virtual void SetBlendMode(int blendMode) override;
 
     virtual bool LoadLoader(void *(*loadProc)(const char *)) override;
@@ -13,6 +13,14 @@ public:
     virtual void Bind() const override;
     virtual void Unbind() const override;
 
+    // Keep the handle overloads visible; they fall back to the name-based setters below
+    using Shader::SetUniformMat4;
+    using Shader::SetUniform4f;
+    using Shader::SetUniform3f;
+    using Shader::SetUniform2f;
+    using Shader::SetUniform1f;
+    using Shader::SetUniform1i;
+
     virtual void SetUniformMat4(const std::string &name, const glm::mat4 &value) override;
     virtual void SetUniform4f(const std::string &name, const glm::vec4 &value) override;
     virtual void SetUniform3f(const std::string &name, const glm::vec3 &value) override;
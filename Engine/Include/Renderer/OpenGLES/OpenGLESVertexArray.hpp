@@ -14,6 +14,8 @@ public:
 
     virtual void AddVertexBuffer(VertexBuffer *vertexBuffer) override;
     virtual void SetIndexBuffer(IndexBuffer *indexBuffer) override;
+    virtual void AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                   const std::vector<uint32_t> &componentCounts) override;
 
     virtual uint32_t GetRendererID() const override { return m_RendererID; }
 
@@ -21,5 +23,6 @@ private:
     uint32_t m_RendererID;
     VertexBuffer *m_VertexBuffer = nullptr;
     IndexBuffer *m_IndexBuffer = nullptr;
+    VertexBuffer *m_InstanceBuffer = nullptr;
 };
 } // namespace TE
@@ -1,5 +1,7 @@
 #pragma once
+#include "Core/PreRequisites.h"
 #include "Renderer/Material.hpp"
+#include "Renderer/RenderQueue.hpp"
 #include "Renderer/VertexArray.hpp"
 #include <glm/glm.hpp>
 #include <memory>
@@ -7,6 +9,16 @@
 
 namespace TE
 {
+class Texture;
+
+// Per-instance stream layout for instanced meshes (attribute locations 1-7 of the instanced quad shader)
+struct BatchInstance
+{
+    glm::mat4 transform;
+    glm::vec4 color;
+    glm::vec4 uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); // xy = offset, zw = size
+    float texSlot = -1.0f;                              // assigned at flush, -1 = untextured
+};
 
 struct BatchDrawCommand
 {
@@ -14,23 +26,66 @@ struct BatchDrawCommand
     std::shared_ptr<Material> material;
     glm::mat4 transform;
     uint32_t indexCount;
-    int blendMode = 0; // 0 = Normal, 1 = Additive, 2 = Multiplicative
+    int blendMode = 0;          // 0 = Normal, 1 = Additive, 2 = Multiplicative
+    int32_t instanceIndex = -1; // >= 0 for instanced meshes, index into the frame's instance stream
+    std::shared_ptr<Texture> texture;
+    uint32_t layer = 0;
 };
 
-class RenderBatcher
+class TE_API RenderBatcher
 {
 public:
+    static constexpr uint32_t MaxInstancesPerDraw = 4096;
+    static constexpr uint32_t MaxTextureSlots = 8;
+    static constexpr uint32_t QuadMesh = 0;
+
+    // Creates the per-instance stream and registers the unit quad as QuadMesh
+    void Init(const std::shared_ptr<VertexArray> &quadVAO);
+    // Same, with a stream the caller created (at least MaxInstancesPerDraw instances), e.g. for a null backend
+    void Init(const std::shared_ptr<VertexArray> &quadVAO, std::unique_ptr<VertexBuffer> instanceBuffer);
+    // Attaches the instance stream to a cached mesh; the returned ID is passed to SubmitInstance
+    uint32_t RegisterMesh(const std::shared_ptr<VertexArray> &vao, uint32_t indexCount);
+
     void Begin();
     void Submit(const std::shared_ptr<VertexArray> &vao, const std::shared_ptr<Material> &material,
                 const glm::mat4 &transform, uint32_t indexCount, int blendMode = 0);
+    // Meshes whose material shader has an instanced variant are merged into one instanced draw per batch.
+    // The color is captured per instance, so a shared material can be recolored between submissions and
+    // materials that differ only in color share a batch.
+    void SubmitInstance(uint32_t mesh, const std::shared_ptr<Material> &material, const glm::mat4 &transform,
+                        const glm::vec4 &color, int blendMode = 0, const std::shared_ptr<Texture> &texture = nullptr,
+                        const glm::vec4 &uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+    void SubmitQuad(const std::shared_ptr<Material> &material, const glm::mat4 &transform, const glm::vec4 &color,
+                    int blendMode = 0, const std::shared_ptr<Texture> &texture = nullptr,
+                    const glm::vec4 &uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f))
+    {
+        SubmitInstance(QuadMesh, material, transform, color, blendMode, texture, uvRect);
+    }
     void End();
     void Flush(); // Issues the actual draw calls, batching by material/shader
 
     void SetViewProjection(const glm::mat4 &viewProjection) { m_ViewProjection = viewProjection; }
+    // Layer for subsequent submissions; lower layers draw first regardless of blend mode or material
+    void SetLayer(uint32_t layer) { m_CurrentLayer = layer; }
 
 private:
-    std::vector<BatchDrawCommand> m_DrawCommands;
+    struct InstancedMesh
+    {
+        std::shared_ptr<VertexArray> vertexArray;
+        uint32_t indexCount;
+    };
+
+    void PushCommand(BatchDrawCommand &&cmd, uint32_t mesh);
+
+    std::vector<BatchDrawCommand> m_DrawCommands; // Payloads, indexed by the queue
+    RenderQueue m_Queue;
+    uint32_t m_CurrentLayer = 0;
     glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+
+    std::vector<InstancedMesh> m_Meshes;
+    std::unique_ptr<VertexBuffer> m_InstanceBuffer; // Streamed, re-filled once per instanced batch
+    std::vector<BatchInstance> m_Instances;         // Per-frame arena, submitted this frame
+    std::vector<BatchInstance> m_InstanceScratch;   // One batch, in upload order
 };
 
-} // namespace TE
\ No newline at end of file
+} // namespace TE
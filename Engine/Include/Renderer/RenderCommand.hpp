@@ -17,6 +17,10 @@ public:
     static void SetClearColor(const glm::vec4 &color) { s_RendererAPI->SetClearColor(color); }
     static void Clear() { s_RendererAPI->Clear(); }
     static void DrawIndexed(uint32_t vao, uint32_t indexCount) { s_RendererAPI->DrawIndexed(vao, indexCount); }
+    static void DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount)
+    {
+        s_RendererAPI->DrawIndexedInstanced(vao, indexCount, instanceCount);
+    }
     static void SetBlendMode(int blendMode) { s_RendererAPI->SetBlendMode(blendMode); }
 
     static bool LoadLoader(void *(*loadProc)(const char *)) { return s_RendererAPI->LoadLoader(loadProc); }
@@ -37,6 +41,8 @@ public:
     }
 
     static RendererAPI *GetAPIInstance() { return s_RendererAPI.get(); }
+    // Replaces the backend chosen from RendererContext, e.g. with a null API for runs without a GPU
+    static void SetAPIInstance(std::unique_ptr<RendererAPI> api) { s_RendererAPI = std::move(api); }
 
 private:
     static std::unique_ptr<RendererAPI> s_RendererAPI;
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TE
+{
+
+// Packs the draw state into one 64-bit key, most significant field first:
+// layer | blend mode | shader | material | mesh | texture | depth.
+// Sorting by the key groups draws so shader and material changes are minimized. IDs are truncated to
+// their field width; a collision can only split a batch, never merge two different materials.
+struct RenderSortKey
+{
+    static constexpr uint32_t LayerBits = 4;
+    static constexpr uint32_t BlendBits = 2;
+    static constexpr uint32_t ShaderBits = 10;
+    static constexpr uint32_t MaterialBits = 16;
+    static constexpr uint32_t MeshBits = 4;
+    static constexpr uint32_t TextureBits = 12;
+    static constexpr uint32_t DepthBits = 16;
+
+    // Mesh value for draws of arbitrary geometry; registered instanced meshes use the values below it
+    static constexpr uint32_t ArbitraryMesh = (1u << MeshBits) - 1u;
+
+    static uint64_t Make(uint32_t layer, uint32_t blendMode, uint32_t shaderID, uint32_t materialID, uint32_t meshID,
+                         uint32_t textureID, float depth);
+
+    // Maps a float to an unsigned value with the same ordering (smaller depth sorts first)
+    static uint32_t QuantizeDepth(float depth);
+};
+
+struct RenderQueueEntry
+{
+    uint64_t Key;
+    uint32_t Payload; // Index into the submitter's own command list
+};
+
+// Key/payload pairs sorted with a stable LSD radix sort, so draw cost is linear in the number of draws
+// and equal keys keep their submission order.
+class RenderQueue
+{
+public:
+    void Clear() { m_Entries.clear(); }
+    void Reserve(size_t count) { m_Entries.reserve(count); }
+    void Push(uint64_t key, uint32_t payload) { m_Entries.push_back({key, payload}); }
+    void Sort();
+
+    const std::vector<RenderQueueEntry> &GetEntries() const { return m_Entries; }
+    size_t Size() const { return m_Entries.size(); }
+
+private:
+    std::vector<RenderQueueEntry> m_Entries;
+    std::vector<RenderQueueEntry> m_Scratch;
+};
+
+} // namespace TE
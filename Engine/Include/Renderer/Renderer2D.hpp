@@ -1,13 +1,17 @@
 #pragma once
 #include "Renderer/RenderBatcher.hpp"
 #include "Renderer/Renderer.hpp"
+#include "Renderer/ShadowOccluderGrid.hpp"
 #include "Utils/MathUtils.hpp"
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace TE
 {
 class LightComponent;
+class Texture;
 
 class Renderer2D : public Renderer
 {
@@ -25,12 +29,22 @@ public:
     // 2D-specific API (example: submit a quad)
     void SubmitQuad(const TEVector2 &position, const TEVector2 &size, const std::shared_ptr<Material> &material);
     void SubmitQuad(const TE::TEMatrix4 &transform, const std::shared_ptr<Material> &material, int blendMode = 0);
+    // Textured quad; uvRect is (offset.x, offset.y, size.x, size.y) in texture space
+    void SubmitQuad(const TE::TEMatrix4 &transform, const std::shared_ptr<Material> &material,
+                    const std::shared_ptr<Texture> &texture,
+                    const TEVector4 &uvRect = TEVector4(0.0f, 0.0f, 1.0f, 1.0f), int blendMode = 0);
     void SubmitTriangle(const TEVector2 &p1, const TEVector2 &p2, const TEVector2 &p3,
                         const std::shared_ptr<Material> &material);
     void SubmitCircle(const TEVector2 &center, float radius, const std::shared_ptr<Material> &material);
     void SubmitLine(const TEVector2 &p1, const TEVector2 &p2, float thickness, const TEColor &color);
     void SubmitLight(const class LightComponent &light, const TEVector2 &position, float rotation = 0.0f);
     void SubmitShadow(const TEVector2 &lightPos, float lightRadius, const std::vector<TEVector2> &vertices);
+    // Shadow volumes for one light against many occluders, all streamed through one instanced batch
+    void SubmitShadows(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder *occluders, size_t count);
+    // Same, restricted to the occluders picked by indices (e.g. a ShadowOccluderGrid query)
+    void SubmitShadows(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder *occluders,
+                       const uint32_t *indices, size_t count);
+    static void BuildShadowHull(const std::vector<TEVector2> &vertices, ShadowOccluder &outOccluder);
     void SetAmbientLight(const TEColor &color, float intensity);
     void SetAmbientGradient(const TEColor &sky, const TEColor &horizon, const TEColor &ground, float intensity = 1.0f,
                             float horizonHeight = 0.5f, float horizonSpread = 0.2f);
@@ -40,11 +54,42 @@ public:
     void SubmitCircleOutline(const TEVector2 &center, float radius, float thickness, const TEColor &color);
 
 private:
+    // Every uniform a light sets; lights with equal values share one material within a frame
+    struct LightMaterialKey
+    {
+        int Type = 0;
+        float Color[4] = {};
+        float Intensity = 0.0f, FalloffExponent = 0.0f;
+        float Direction[2] = {};
+        float InnerAngle = 0.0f, OuterAngle = 0.0f;
+        float LineLength = 0.0f, Radius = 0.0f;
+
+        bool operator==(const LightMaterialKey &other) const;
+    };
+    struct LightMaterialKeyHash
+    {
+        size_t operator()(const LightMaterialKey &key) const;
+    };
+
+    void SubmitShadowVolume(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder &occluder);
+    const std::shared_ptr<Material> &GetLightMaterial(const LightMaterialKey &key);
+
     RenderBatcher m_Batcher;
 
     std::shared_ptr<VertexArray> m_UnitQuadVAO;
+    std::shared_ptr<VertexArray> m_UnitCircleVAO;
+    std::shared_ptr<VertexArray> m_UnitTriangleVAO;
+    uint32_t m_CircleMesh = 0;
+    uint32_t m_TriangleMesh = 0;
     std::shared_ptr<Material> m_Light2DMaterial;
 
+    // Light materials are recycled frame to frame so their IDs (and sort keys) stay stable; the first
+    // m_LightMaterialsUsed are taken this frame
+    std::vector<std::shared_ptr<Material>> m_LightMaterials;
+    size_t m_LightMaterialsUsed = 0;
+    std::unordered_map<LightMaterialKey, size_t, LightMaterialKeyHash> m_LightMaterialLookup;
+    std::shared_ptr<Material> m_ShadowMaterial;
+
     // Ambient Gradient State (No default ambient light)
     TEColor m_AmbientSky = TEColor(0.04f, 0.04f, 0.06f, 1.0f);
     TEColor m_AmbientHorizon = TEColor(0.08f, 0.08f, 0.12f, 1.0f);
@@ -26,6 +26,7 @@ public:
     virtual void SetClearColor(const glm::vec4 &color) = 0;
     virtual void Clear() = 0;
     virtual void DrawIndexed(uint32_t vao, uint32_t indexCount) = 0;
+    virtual void DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount) = 0;
     virtual void SetBlendMode(int blendMode) = 0;
 
     virtual bool LoadLoader(void *(*loadProc)(const char *)) = 0;
@@ -2,14 +2,33 @@
 #include "Core/Asset/Asset.hpp"
 #include "Core/PreRequisites.h"
 #include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
 
 namespace TE
 {
-class Shader : public Asset
+// Resolved uniform slot. Resolve a name once with GetUniformHandle, then upload by integer slot.
+struct UniformHandle
+{
+    int32_t Location = -1;
+
+    bool IsValid() const { return Location >= 0; }
+};
+
+class TE_API Shader : public Asset
 {
 public:
     static Shader *Create(const std::string &vertexSrc, const std::string &fragmentSrc);
 
+    // Handles for the uniforms every batched draw touches, resolved on first use
+    struct CommonUniformHandles
+    {
+        UniformHandle Transform;
+        UniformHandle ViewProjection;
+        UniformHandle Color;
+    };
+
+    Shader();
     virtual ~Shader() = default;
     virtual void Bind() const = 0;
     virtual void Unbind() const = 0;
@@ -21,6 +40,25 @@ public:
     virtual void SetUniform1f(const std::string &name, float value) = 0;
     virtual void SetUniform1i(const std::string &name, int value) = 0;
 
+    // Handle-based uploads. Backends without a reflection cache fall back to the name-based setters.
+    virtual UniformHandle GetUniformHandle(const std::string &name);
+    virtual void SetUniformMat4(UniformHandle handle, const glm::mat4 &value);
+    virtual void SetUniform4f(UniformHandle handle, const glm::vec4 &value);
+    virtual void SetUniform3f(UniformHandle handle, const glm::vec3 &value);
+    virtual void SetUniform2f(UniformHandle handle, const glm::vec2 &value);
+    virtual void SetUniform1f(UniformHandle handle, float value);
+    virtual void SetUniform1i(UniformHandle handle, int value);
+
+    const CommonUniformHandles &GetCommonHandles();
+
+    // Unique per program for the lifetime of the process (never reused, unlike the pointer)
+    uint32_t GetShaderID() const { return m_ShaderID; }
+
+    // Optional companion program that reads transform/color from a per-instance stream.
+    // RenderBatcher draws quads with this variant when present, one instanced call per batch.
+    void SetInstancedVariant(const std::shared_ptr<Shader> &variant) { m_InstancedVariant = variant; }
+    const std::shared_ptr<Shader> &GetInstancedVariant() const { return m_InstancedVariant; }
+
     // Asset Interface
     virtual AssetHandle GetHandle() const override { return m_Handle; }
     virtual const std::string &GetType() const override
@@ -44,5 +82,15 @@ public:
 protected:
     AssetHandle m_Handle = 0;
     std::string m_Name = "Unnamed Shader";
+    std::shared_ptr<Shader> m_InstancedVariant;
+
+private:
+    uint32_t m_ShaderID = 0;
+    CommonUniformHandles m_CommonHandles;
+    bool m_CommonHandlesResolved = false;
+
+    // Fallback handle table: handle.Location indexes m_FallbackUniformNames
+    std::unordered_map<std::string, int32_t> m_FallbackUniformIndices;
+    std::vector<std::string> m_FallbackUniformNames;
 };
 } // namespace TE
@@ -26,6 +26,7 @@ public:
     static std::shared_ptr<Shader> CreateLight2DShader();
     static std::shared_ptr<Shader> CreateAmbientGradientShader();
     static std::shared_ptr<Shader> CreateLightBlendShader();
+    static std::shared_ptr<Shader> CreateInstancedQuadShader();
 
     // ===== Common Shader Functions =====
     static void SetMVP(Shader *shader, const glm::mat4 &model, const glm::mat4 &view, const glm::mat4 &projection);
@@ -113,6 +114,8 @@ protected:
     static std::string GetAmbientGradientFragmentShader();
     static std::string GetLightBlendVertexShader();
     static std::string GetLightBlendFragmentShader();
+    static std::string GetInstancedQuadVertexShader();
+    static std::string GetInstancedQuadFragmentShader();
 };
 
 } // namespace TE
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "Utils/MathUtils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TE
+{
+
+// Convex, counter-clockwise world-space outline of a shadow caster with its bounding circle.
+// Build once with Renderer2D::BuildShadowHull and reuse it for every light.
+struct ShadowOccluder
+{
+    std::vector<TEVector2> Hull;
+    TEVector2 Center;
+    float Radius = 0.0f;
+};
+
+// Uniform grid over occluder bounding circles, stored as flat cell ranges (no per-cell allocations).
+// Rebuilding is linear in the number of occluders, so it is cheap enough to do once per frame.
+class ShadowOccluderGrid
+{
+public:
+    static constexpr uint32_t MaxCellsPerAxis = 256;
+
+    // A cellSize <= 0 picks one from the average occluder size
+    void Build(const ShadowOccluder *occluders, size_t count, float cellSize = 0.0f);
+    // Appends the index of every occluder whose cell range overlaps the circle, each at most once
+    void Query(const TEVector2 &center, float radius, std::vector<uint32_t> &outIndices) const;
+
+    size_t GetOccluderCount() const { return m_Stamps.size(); }
+
+private:
+    struct CellRange
+    {
+        int32_t MinX, MinY, MaxX, MaxY;
+    };
+
+    CellRange GetCellRange(const TEVector2 &center, float radius) const;
+
+    TEVector2 m_Origin;
+    float m_InvCellSize = 1.0f;
+    int32_t m_CellsX = 0;
+    int32_t m_CellsY = 0;
+
+    std::vector<uint32_t> m_CellStart;   // m_CellsX * m_CellsY + 1 offsets into m_CellEntries
+    std::vector<uint32_t> m_CellEntries; // Occluder indices grouped by cell
+    std::vector<CellRange> m_Ranges;     // Per occluder, reused between the count and fill passes
+    std::vector<uint32_t> m_CellCursor;  // Per cell, next free entry during the fill pass
+
+    mutable std::vector<uint32_t> m_Stamps; // Per occluder, last query that returned it
+    mutable uint32_t m_QueryStamp = 0;
+};
+
+} // namespace TE
@@ -1,6 +1,7 @@
 #pragma once
 #include "IndexBuffer.hpp"
 #include "VertexBuffer.hpp"
+#include <vector>
 
 namespace TE {
 	class VertexArray {
@@ -13,6 +14,11 @@ namespace TE {
 
 		virtual void AddVertexBuffer(VertexBuffer* vertexBuffer) = 0;
 		virtual void SetIndexBuffer(IndexBuffer* indexBuffer) = 0;
+
+		// Attach a per-instance float stream. Each entry of componentCounts is one attribute (1-4 floats)
+		// starting at firstLocation; the stride is the sum of all components.
+		virtual void AddInstanceBuffer(VertexBuffer* vertexBuffer, uint32_t firstLocation,
+			const std::vector<uint32_t>& componentCounts) = 0;
 		
 		// Get the renderer ID (OpenGL VAO ID)
 		virtual uint32_t GetRendererID() const = 0;
@@ -15,11 +15,14 @@ public:
 
     virtual void AddVertexBuffer(VertexBuffer *vertexBuffer) override;
     virtual void SetIndexBuffer(IndexBuffer *indexBuffer) override;
+    virtual void AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                   const std::vector<uint32_t> &componentCounts) override;
 
     virtual uint32_t GetRendererID() const override { return 0; } // Vulkan uses custom pipelines and bindings
 
 private:
     VertexBuffer *m_VertexBuffer = nullptr;
     IndexBuffer *m_IndexBuffer = nullptr;
+    VertexBuffer *m_InstanceBuffer = nullptr;
 };
 } // namespace TE
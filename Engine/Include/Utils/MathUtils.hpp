@@ -263,6 +263,12 @@ struct TE_API TEMatrix4
     TEVector4 &operator[](int index) { return m[index]; }
     const TEVector4 &operator[](int index) const { return m[index]; }
 
+    bool operator==(const TEMatrix4 &rhs) const
+    {
+        return m[0] == rhs.m[0] && m[1] == rhs.m[1] && m[2] == rhs.m[2] && m[3] == rhs.m[3];
+    }
+    bool operator!=(const TEMatrix4 &rhs) const { return !(*this == rhs); }
+
     static TEMatrix4 Scale(const TEMatrix4 &mat, const TEVector &scale);
     static TEMatrix4 Translate(const TEMatrix4 &mat, const TEVector &translation);
     static TEMatrix4 Ortho(float left, float right, float bottom, float top, float zNear, float zFar);
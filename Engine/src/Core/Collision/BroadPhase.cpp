@@ -1,4 +1,5 @@
 #include "Core/Collision/BroadPhase.hpp"
+#include <algorithm>
 
 namespace TE
 {
@@ -19,4 +20,65 @@ std::vector<CollisionPair> BroadPhase::BruteForce(const std::vector<CollisionCom
     return pairs;
 }
 
+void BroadPhase::BruteForce(const std::vector<BoundsAABB> &bounds, std::vector<ColliderPair> &outPairs)
+{
+    outPairs.clear();
+    for (uint32_t i = 0; i < bounds.size(); ++i)
+    {
+        for (uint32_t j = i + 1; j < bounds.size(); ++j)
+        {
+            if (Overlaps(bounds[i], bounds[j]))
+                outPairs.push_back({i, j});
+        }
+    }
+}
+
+void BroadPhase::SortAndSweep(const std::vector<BoundsAABB> &bounds, std::vector<ColliderPair> &outPairs,
+                              std::vector<uint32_t> &scratchOrder)
+{
+    outPairs.clear();
+
+    // Colliders barely move between frames, so the previous order is nearly sorted already and an
+    // insertion sort stays close to linear. A changed collider count invalidates it, so sort from scratch.
+    if (scratchOrder.size() != bounds.size())
+    {
+        scratchOrder.resize(bounds.size());
+        for (uint32_t i = 0; i < bounds.size(); ++i)
+            scratchOrder[i] = i;
+        std::sort(scratchOrder.begin(), scratchOrder.end(),
+                  [&](uint32_t a, uint32_t b) { return bounds[a].min.x < bounds[b].min.x; });
+    }
+
+    for (size_t i = 1; i < scratchOrder.size(); ++i)
+    {
+        uint32_t index = scratchOrder[i];
+        float key = bounds[index].min.x;
+        size_t j = i;
+        while (j > 0 && bounds[scratchOrder[j - 1]].min.x > key)
+        {
+            scratchOrder[j] = scratchOrder[j - 1];
+            --j;
+        }
+        scratchOrder[j] = index;
+    }
+
+    // Sweep along x; once a later box starts past this one's right edge, no further box can overlap it
+    for (size_t i = 0; i < scratchOrder.size(); ++i)
+    {
+        const BoundsAABB &a = bounds[scratchOrder[i]];
+        for (size_t j = i + 1; j < scratchOrder.size(); ++j)
+        {
+            const BoundsAABB &b = bounds[scratchOrder[j]];
+            if (b.min.x > a.max.x)
+                break;
+            if (a.max.y < b.min.y || a.min.y > b.max.y)
+                continue;
+
+            uint32_t first = scratchOrder[i];
+            uint32_t second = scratchOrder[j];
+            outPairs.push_back({std::min(first, second), std::max(first, second)});
+        }
+    }
+}
+
 } // namespace TE
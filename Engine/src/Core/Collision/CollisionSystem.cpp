@@ -11,228 +11,491 @@ void CollisionSystem::Process()
     if (!m_EntityManager)
         return;
 
-    // Collect all collision components
-    std::vector<CollisionComponent *> allColliders;
-    for (EntityID id : m_EntityManager->GetAliveEntities())
-    {
-        auto colliders = m_EntityManager->GetComponents<CollisionComponent>(id);
-        for (auto *col : colliders)
+    ++m_Frame;
+
+    // Collect all collision components, streaming over the packed collider pool
+    m_Colliders.clear();
+    m_ColliderOwners.clear();
+    auto colliders = m_EntityManager->View<CollisionComponent>();
+    colliders.EachInstance(
+        [&](EntityID id, CollisionComponent &col)
         {
-            // Calculate world transform for this component
-            TEMatrix4 worldTransform = TEMatrix4(1.0f);
-            TComponent *current = col;
-            while (current)
-            {
-                worldTransform = current->Transform.GetMatrix() * worldTransform;
-                current = current->GetParentComponent();
-            }
+            m_Colliders.push_back(&col);
+            m_ColliderOwners.push_back(id);
+        });
+
+    // Shapes are independent, so they update in contiguous chunks that each write only their own slots
+    const size_t minChunkSize = 64;
+    m_Bounds.resize(m_Colliders.size());
+    if (m_Parallelism == 1)
+    {
+        UpdateShapes(0, m_Colliders.size());
+    }
+    else
+    {
+        TaskSystem::ParallelFor(m_TaskPool, m_Colliders.size(), m_Parallelism, minChunkSize,
+                                [this](size_t begin, size_t end, size_t) { UpdateShapes(begin, end); });
+    }
 
-            // Update the collider shape with world-space data
-            col->OnUpdateShape(worldTransform);
-            allColliders.push_back(col);
-        }
+    FindCandidatePairs();
+
+    // Only pairs with overlapping bounds reach the narrow phase. Each chunk fills its own buffer and the
+    // buffers are concatenated in chunk order, which reproduces the serial contact order exactly.
+    m_Contacts.clear();
+    if (m_Parallelism == 1)
+    {
+        TestPairs(0, m_CandidatePairs.size(), m_Contacts);
     }
+    else
+    {
+        size_t maxChunks = m_Parallelism == 0 ? TaskSystem::GetThreadCount(m_TaskPool) + 1 : m_Parallelism;
+        if (m_ChunkContacts.size() < maxChunks)
+            m_ChunkContacts.resize(maxChunks);
+
+        size_t chunks = TaskSystem::ParallelFor(m_TaskPool, m_CandidatePairs.size(), maxChunks, minChunkSize,
+                                                [this](size_t begin, size_t end, size_t chunk)
+                                                {
+                                                    m_ChunkContacts[chunk].clear();
+                                                    TestPairs(begin, end, m_ChunkContacts[chunk]);
+                                                });
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+            m_Contacts.insert(m_Contacts.end(), m_ChunkContacts[chunk].begin(), m_ChunkContacts[chunk].end());
+    }
+
+    // Flags and callbacks stay on the calling thread
+    for (const CollisionContact &contact : m_Contacts)
+    {
+        contact.colliderA->collided = contact.colliderB->collided = true;
+        if (onCollision)
+            onCollision(contact.a, contact.b);
+    }
+
+    UpdatePairCache();
 
-    auto pairs = BroadPhase::BruteForce(allColliders);
+    if (OnCollisionBegin && !m_BeginEvents.empty())
+        OnCollisionBegin(m_BeginEvents);
+    if (OnCollisionStay && !m_StayEvents.empty())
+        OnCollisionStay(m_StayEvents);
+    if (OnCollisionEnd && !m_EndEvents.empty())
+        OnCollisionEnd(m_EndEvents);
+}
 
-    for (const auto &pair : pairs)
+void CollisionSystem::UpdateShapes(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
     {
-        auto collidersA = m_EntityManager->GetComponents<CollisionComponent>(pair.a);
-        auto collidersB = m_EntityManager->GetComponents<CollisionComponent>(pair.b);
+        CollisionComponent &col = *m_Colliders[i];
 
-        for (auto *compA : collidersA)
+        // Calculate world transform for this component
+        TEMatrix4 worldTransform = TEMatrix4(1.0f);
+        if (m_TransformSystem)
+        {
+            worldTransform = m_TransformSystem->GetWorldMatrix(&col);
+        }
+        else
         {
-            for (auto *compB : collidersB)
+            TComponent *current = &col;
+            while (current)
             {
-                if (compA->isStatic && compB->isStatic)
-                    continue;
-
-                if (CheckCollision(compA, compB))
-                {
-                    compA->collided = compB->collided = true;
-                    if (onCollision)
-                        onCollision(pair.a, pair.b);
-                }
+                worldTransform = current->Transform.GetMatrix() * worldTransform;
+                current = current->GetParentComponent();
             }
         }
+
+        // Update the collider shape with world-space data
+        col.OnUpdateShape(worldTransform);
+        col.collided = false;
+        m_Bounds[i] = GetShapeBounds(col.shape);
     }
 }
 
-bool CollisionSystem::CheckCollision(CollisionComponent *a, CollisionComponent *b)
+void CollisionSystem::TestPairs(size_t begin, size_t end, std::vector<CollisionContact> &outContacts) const
 {
-    CollisionShape &sa = a->shape;
-    CollisionShape &sb = b->shape;
-
-    // AABB vs AABB
-    if (sa.type == CollisionType::AABB && sb.type == CollisionType::AABB)
+    for (size_t i = begin; i < end; ++i)
     {
-        return AABBvsAABB(sa.aabb, sb.aabb);
+        const ColliderPair &pair = m_CandidatePairs[i];
+        CollisionComponent *compA = m_Colliders[pair.a];
+        CollisionComponent *compB = m_Colliders[pair.b];
+        EntityID ownerA = m_ColliderOwners[pair.a];
+        EntityID ownerB = m_ColliderOwners[pair.b];
+
+        // Colliders sharing an entity never collide with each other
+        if (ownerA == ownerB || (compA->isStatic && compB->isStatic))
+            continue;
+
+        ContactManifold manifold;
+        if (CheckCollision(compA, compB, manifold))
+            outContacts.push_back({ownerA, ownerB, compA, compB, manifold});
     }
-    // Circle vs Circle
-    if (sa.type == CollisionType::Circle && sb.type == CollisionType::Circle)
+}
+
+void CollisionSystem::UpdatePairCache()
+{
+    // Fold this step's collider contacts into per-entity-pair entries, keeping the deepest manifold
+    for (const CollisionContact &contact : m_Contacts)
     {
-        return CircleVsCircle(sa.circle, sb.circle);
-    }
+        bool swapped = contact.b < contact.a;
+        std::pair<EntityID, EntityID> key = swapped ? std::make_pair(contact.b, contact.a)
+                                                    : std::make_pair(contact.a, contact.b);
+        ContactManifold manifold = contact.manifold;
+        if (swapped)
+            manifold.normal = -manifold.normal;
+
+        auto it = m_PairIndex.find(key);
+        if (it == m_PairIndex.end())
+        {
+            m_PairIndex.emplace(key, (uint32_t)m_Pairs.size());
+            m_Pairs.push_back({{key.first, key.second, manifold}, m_Frame, m_Frame});
+            continue;
+        }
 
-    // Polygon-based SAT (Triangle is a polygon with 3 points)
-    std::vector<TEVector2> pointsA, pointsB;
+        CachedPair &cached = m_Pairs[it->second];
+        if (cached.LastFrame != m_Frame || manifold.depth > cached.Event.manifold.depth)
+            cached.Event.manifold = manifold;
+        cached.LastFrame = m_Frame;
+    }
 
-    auto GetPoints = [](const CollisionShape &s, std::vector<TEVector2> &out)
+    // Classify every cached pair; the ones not touched this step ended
+    m_BeginEvents.clear();
+    m_StayEvents.clear();
+    m_EndEvents.clear();
+    for (size_t i = 0; i < m_Pairs.size();)
     {
-        if (s.type == CollisionType::AABB)
+        CachedPair &cached = m_Pairs[i];
+        if (cached.LastFrame == m_Frame)
         {
-            out = {{s.aabb.min.x, s.aabb.min.y},
-                   {s.aabb.max.x, s.aabb.min.y},
-                   {s.aabb.max.x, s.aabb.max.y},
-                   {s.aabb.min.x, s.aabb.max.y}};
+            (cached.FirstFrame == m_Frame ? m_BeginEvents : m_StayEvents).push_back(cached.Event);
+            ++i;
+            continue;
         }
-        else if (s.type == CollisionType::Triangle)
+
+        m_EndEvents.push_back(cached.Event);
+        m_PairIndex.erase({cached.Event.a, cached.Event.b});
+        if (i + 1 != m_Pairs.size())
         {
-            out = {s.triangle.points[0], s.triangle.points[1], s.triangle.points[2]};
+            cached = m_Pairs.back();
+            m_PairIndex[{cached.Event.a, cached.Event.b}] = (uint32_t)i;
         }
-        else if (s.type == CollisionType::Polygon)
+        m_Pairs.pop_back();
+    }
+}
+
+void CollisionSystem::FindCandidatePairs()
+{
+    switch (m_BroadPhaseType)
+    {
+    case BroadPhaseType::BruteForce:
+        BroadPhase::BruteForce(m_Bounds, m_CandidatePairs);
+        return;
+    case BroadPhaseType::SortAndSweep:
+        BroadPhase::SortAndSweep(m_Bounds, m_CandidatePairs, m_SweepOrder);
+        return;
+    case BroadPhaseType::DynamicTree:
+        break;
+    }
+
+    // Sync the tree: moved colliders only reinsert once they leave their fattened bounds
+    for (uint32_t i = 0; i < m_Colliders.size(); ++i)
+    {
+        auto it = m_Proxies.find(m_Colliders[i]);
+        if (it == m_Proxies.end())
         {
-            out = s.polygon.points;
+            m_Proxies.emplace(m_Colliders[i], ColliderProxy{m_Tree.CreateProxy(m_Bounds[i], i), m_Frame});
+            continue;
         }
-    };
 
-    if (sa.type == CollisionType::Circle || sb.type == CollisionType::Circle)
+        m_Tree.MoveProxy(it->second.Proxy, m_Bounds[i]);
+        m_Tree.SetUserData(it->second.Proxy, i);
+        it->second.LastFrame = m_Frame;
+    }
+
+    // Drop proxies of colliders that were removed since the last frame
+    for (auto it = m_Proxies.begin(); it != m_Proxies.end();)
     {
-        if (sa.type == CollisionType::Circle)
+        if (it->second.LastFrame != m_Frame)
         {
-            GetPoints(sb, pointsB);
-            return CircleVsPoly(sa.circle, pointsB);
+            m_Tree.DestroyProxy(it->second.Proxy);
+            it = m_Proxies.erase(it);
         }
         else
         {
-            GetPoints(sa, pointsA);
-            return CircleVsPoly(sb.circle, pointsA);
+            ++it;
         }
     }
 
-    GetPoints(sa, pointsA);
-    GetPoints(sb, pointsB);
-    return PolyVsPoly(pointsA, pointsB);
+    // Each collider queries the tree with its tight bounds; emitting only higher indices reports every pair once
+    m_CandidatePairs.clear();
+    for (uint32_t i = 0; i < m_Colliders.size(); ++i)
+    {
+        m_Tree.Query(m_Bounds[i],
+                     [&](int32_t proxy)
+                     {
+                         uint32_t other = m_Tree.GetUserData(proxy);
+                         if (other > i && BroadPhase::Overlaps(m_Bounds[i], m_Bounds[other]))
+                             m_CandidatePairs.push_back({i, other});
+                         return true;
+                     });
+    }
 }
 
-bool CollisionSystem::AABBvsAABB(const BoundsAABB &a, const BoundsAABB &b)
+// ===== Narrow phase =====
+// Every routine reads the cached world-space vertices and normals of the shapes and writes into the caller's
+// manifold, so testing a pair never touches the heap.
+
+using CollideFunction = bool (*)(const CollisionShape &, const CollisionShape &, ContactManifold &);
+
+static bool CollideAABBs(const CollisionShape &a, const CollisionShape &b, ContactManifold &manifold)
 {
-    return !(a.max.x < b.min.x || a.min.x > b.max.x || a.max.y < b.min.y || a.min.y > b.max.y);
+    const BoundsAABB &ba = a.aabb;
+    const BoundsAABB &bb = b.aabb;
+    if (ba.max.x < bb.min.x || bb.max.x < ba.min.x || ba.max.y < bb.min.y || bb.max.y < ba.min.y)
+        return false;
+
+    // Distance b has to travel along each direction to leave a; the shortest one is the contact normal
+    float pushes[4] = {ba.max.x - bb.min.x, bb.max.x - ba.min.x, ba.max.y - bb.min.y, bb.max.y - ba.min.y};
+    int axis = 0;
+    for (int i = 1; i < 4; ++i)
+    {
+        if (pushes[i] < pushes[axis])
+            axis = i;
+    }
+
+    // The contact edge spans the overlap on the other axis, on b's face
+    float minX = std::max(ba.min.x, bb.min.x), maxX = std::min(ba.max.x, bb.max.x);
+    float minY = std::max(ba.min.y, bb.min.y), maxY = std::min(ba.max.y, bb.max.y);
+    manifold.depth = pushes[axis];
+    switch (axis)
+    {
+    case 0:
+        manifold.normal = {1.0f, 0.0f};
+        manifold.points[0] = {bb.min.x, minY};
+        manifold.points[1] = {bb.min.x, maxY};
+        break;
+    case 1:
+        manifold.normal = {-1.0f, 0.0f};
+        manifold.points[0] = {bb.max.x, minY};
+        manifold.points[1] = {bb.max.x, maxY};
+        break;
+    case 2:
+        manifold.normal = {0.0f, 1.0f};
+        manifold.points[0] = {minX, bb.min.y};
+        manifold.points[1] = {maxX, bb.min.y};
+        break;
+    default:
+        manifold.normal = {0.0f, -1.0f};
+        manifold.points[0] = {minX, bb.max.y};
+        manifold.points[1] = {maxX, bb.max.y};
+        break;
+    }
+    manifold.pointCount = manifold.points[0] == manifold.points[1] ? 1 : 2;
+    return true;
 }
 
-bool CollisionSystem::CircleVsCircle(const BoundsCircle &a, const BoundsCircle &b)
+static bool CollideCircles(const CollisionShape &a, const CollisionShape &b, ContactManifold &manifold)
 {
-    float r = a.radius + b.radius;
-    float dx = a.center.x - b.center.x;
-    float dy = a.center.y - b.center.y;
-    return (dx * dx + dy * dy) <= r * r;
+    TEVector2 delta = b.circle.center - a.circle.center;
+    float radius = a.circle.radius + b.circle.radius;
+    float distSq = delta.LengthSquared();
+    if (distSq > radius * radius)
+        return false;
+
+    float dist = std::sqrt(distSq);
+    manifold.normal = dist > 0.0f ? delta / dist : TEVector2(0.0f, 1.0f);
+    manifold.depth = radius - dist;
+    manifold.points[0] = a.circle.center + manifold.normal * (a.circle.radius - manifold.depth * 0.5f);
+    manifold.pointCount = 1;
+    return true;
 }
 
-bool CollisionSystem::PolyVsPoly(const std::vector<TEVector2> &a, const std::vector<TEVector2> &b)
+// Polygon (any shape with cached vertices) against circle, normal from polygon to circle
+static bool CollidePolygonCircle(const CollisionShape &a, const CollisionShape &b, ContactManifold &manifold)
 {
-    if (a.empty() || b.empty())
+    const std::vector<TEVector2> &verts = a.vertices;
+    const std::vector<TEVector2> &normals = a.normals;
+    const TEVector2 &center = b.circle.center;
+    float radius = b.circle.radius;
+    if (verts.empty())
         return false;
 
-    auto axesA = GetAxes(a);
-    auto axesB = GetAxes(b);
-
-    for (const auto &axis : axesA)
+    // Face of least penetration
+    size_t face = 0;
+    float separation = -FLT_MAX;
+    for (size_t i = 0; i < verts.size(); ++i)
     {
-        float minA, maxA, minB, maxB;
-        Project(a, axis, minA, maxA);
-        Project(b, axis, minB, maxB);
-        if (maxA < minB || maxB < minA)
+        float s = Dot(normals[i], center - verts[i]);
+        if (s > radius)
             return false;
+        if (s > separation)
+        {
+            separation = s;
+            face = i;
+        }
+    }
+
+    const TEVector2 &v1 = verts[face];
+    const TEVector2 &v2 = verts[(face + 1) % verts.size()];
+    manifold.pointCount = 1;
+
+    // Center inside the polygon
+    if (separation <= 0.0f)
+    {
+        manifold.normal = normals[face];
+        manifold.depth = radius - separation;
+        manifold.points[0] = center - normals[face] * separation;
+        return true;
     }
 
-    for (const auto &axis : axesB)
+    // Center beyond one of the face's vertices: the contact is that vertex
+    const TEVector2 *corner = nullptr;
+    if (Dot(center - v1, v2 - v1) <= 0.0f)
+        corner = &v1;
+    else if (Dot(center - v2, v1 - v2) <= 0.0f)
+        corner = &v2;
+
+    if (corner)
     {
-        float minA, maxA, minB, maxB;
-        Project(a, axis, minA, maxA);
-        Project(b, axis, minB, maxB);
-        if (maxA < minB || maxB < minA)
+        TEVector2 delta = center - *corner;
+        float distSq = delta.LengthSquared();
+        if (distSq > radius * radius)
             return false;
+
+        float dist = std::sqrt(distSq);
+        manifold.normal = dist > 0.0f ? delta / dist : normals[face];
+        manifold.depth = radius - dist;
+        manifold.points[0] = *corner;
+        return true;
     }
 
+    manifold.normal = normals[face];
+    manifold.depth = radius - separation;
+    manifold.points[0] = center - normals[face] * separation;
     return true;
 }
 
-bool CollisionSystem::CircleVsPoly(const BoundsCircle &circle, const std::vector<TEVector2> &poly)
+static bool CollideCirclePolygon(const CollisionShape &a, const CollisionShape &b, ContactManifold &manifold)
 {
-    if (poly.empty())
+    if (!CollidePolygonCircle(b, a, manifold))
         return false;
+    manifold.normal = -manifold.normal;
+    return true;
+}
 
-    // Find closest point on poly to circle center
-    float minDistSq = FLT_MAX;
-    TEVector2 closestPoint;
-
-    for (size_t i = 0; i < poly.size(); i++)
+// Largest separation of b from any face of a; a positive result is a separating axis
+static float FindMaxSeparation(const CollisionShape &a, const CollisionShape &b, size_t &outFace)
+{
+    float maxSeparation = -FLT_MAX;
+    for (size_t i = 0; i < a.vertices.size(); ++i)
     {
-        TEVector2 v1 = poly[i];
-        TEVector2 v2 = poly[(i + 1) % poly.size()];
-
-        // Closest point on segment v1-v2
-        TEVector2 seg = {v2.x - v1.x, v2.y - v1.y};
-        TEVector2 rel = {circle.center.x - v1.x, circle.center.y - v1.y};
-        float t = (rel.x * seg.x + rel.y * seg.y) / (seg.x * seg.x + seg.y * seg.y);
-        t = std::max(0.0f, std::min(1.0f, t));
-
-        TEVector2 p = {v1.x + t * seg.x, v1.y + t * seg.y};
-        float dx = circle.center.x - p.x;
-        float dy = circle.center.y - p.y;
-        float distSq = dx * dx + dy * dy;
+        float minDist = FLT_MAX;
+        for (const TEVector2 &v : b.vertices)
+            minDist = std::min(minDist, Dot(a.normals[i], v - a.vertices[i]));
 
-        if (distSq < minDistSq)
+        if (minDist > maxSeparation)
         {
-            minDistSq = distSq;
-            closestPoint = p;
+            maxSeparation = minDist;
+            outFace = i;
         }
+        if (maxSeparation > 0.0f)
+            break;
     }
+    return maxSeparation;
+}
 
-    // Also check if circle center is inside poly
-    bool inside = false;
-    for (size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++)
+// Keeps the part of segment in[] behind the plane dot(normal, p) <= offset
+static int ClipSegment(TEVector2 out[2], const TEVector2 in[2], const TEVector2 &normal, float offset)
+{
+    int count = 0;
+    float d0 = Dot(normal, in[0]) - offset;
+    float d1 = Dot(normal, in[1]) - offset;
+    if (d0 <= 0.0f)
+        out[count++] = in[0];
+    if (d1 <= 0.0f)
+        out[count++] = in[1];
+    // One end kept, the other not: add the crossing point. An end lying exactly on the plane still counts as
+    // kept, so a touching segment yields that point twice rather than a single point the caller would reject
+    if ((d0 <= 0.0f) != (d1 <= 0.0f))
+        out[count++] = in[0] + (in[1] - in[0]) * (d0 / (d0 - d1));
+    return count;
+}
+
+// SAT between convex outlines, clipping the incident edge against the reference face for up to two contacts
+static bool CollidePolygons(const CollisionShape &a, const CollisionShape &b, ContactManifold &manifold)
+{
+    if (a.vertices.empty() || b.vertices.empty())
+        return false;
+
+    size_t faceA = 0, faceB = 0;
+    float separationA = FindMaxSeparation(a, b, faceA);
+    if (separationA > 0.0f)
+        return false;
+    float separationB = FindMaxSeparation(b, a, faceB);
+    if (separationB > 0.0f)
+        return false;
+
+    // Prefer a's face unless b's is clearly shallower, to keep the reference stable between frames
+    const float relativeTolerance = 0.98f, absoluteTolerance = 0.001f;
+    bool flip = separationB > relativeTolerance * separationA + absoluteTolerance;
+    const CollisionShape &ref = flip ? b : a;
+    const CollisionShape &inc = flip ? a : b;
+    size_t refFace = flip ? faceB : faceA;
+
+    const TEVector2 &refNormal = ref.normals[refFace];
+    TEVector2 ref1 = ref.vertices[refFace];
+    TEVector2 ref2 = ref.vertices[(refFace + 1) % ref.vertices.size()];
+
+    // Incident edge: the one facing most against the reference normal
+    size_t incFace = 0;
+    float minDot = FLT_MAX;
+    for (size_t i = 0; i < inc.normals.size(); ++i)
     {
-        if (((poly[i].y > circle.center.y) != (poly[j].y > circle.center.y)) &&
-            (circle.center.x <
-             (poly[j].x - poly[i].x) * (circle.center.y - poly[i].y) / (poly[j].y - poly[i].y) + poly[i].x))
+        float d = Dot(refNormal, inc.normals[i]);
+        if (d < minDot)
         {
-            inside = !inside;
+            minDot = d;
+            incFace = i;
         }
     }
+    TEVector2 incident[2] = {inc.vertices[incFace], inc.vertices[(incFace + 1) % inc.vertices.size()]};
 
-    return inside || (minDistSq <= circle.radius * circle.radius);
-}
+    // Clip against the side planes of the reference face
+    TEVector2 tangent = (ref2 - ref1).Normalized();
+    TEVector2 clip1[3], clip2[3];
+    if (ClipSegment(clip1, incident, -tangent, -Dot(tangent, ref1)) < 2)
+        return false;
+    if (ClipSegment(clip2, clip1, tangent, Dot(tangent, ref2)) < 2)
+        return false;
 
-std::vector<TEVector2> CollisionSystem::GetAxes(const std::vector<TEVector2> &points)
-{
-    std::vector<TEVector2> axes;
-    for (size_t i = 0; i < points.size(); i++)
-    {
-        TEVector2 p1 = points[i];
-        TEVector2 p2 = points[(i + 1) % points.size()];
-        TEVector2 edge = {p1.x - p2.x, p1.y - p2.y};
-        TEVector2 normal = {-edge.y, edge.x}; // Perpendicular
-        float len = sqrt(normal.x * normal.x + normal.y * normal.y);
-        if (len > 0)
-            axes.push_back({normal.x / len, normal.y / len});
-    }
-    return axes;
+    float refOffset = Dot(refNormal, ref1);
+    manifold.normal = flip ? -refNormal : refNormal;
+    manifold.depth = 0.0f;
+    manifold.pointCount = 0;
+    for (int i = 0; i < 2; ++i)
+    {
+        float separation = Dot(refNormal, clip2[i]) - refOffset;
+        if (separation <= 0.0f)
+        {
+            manifold.points[manifold.pointCount++] = clip2[i];
+            manifold.depth = std::max(manifold.depth, -separation);
+        }
+    }
+    return manifold.pointCount > 0;
 }
 
-void CollisionSystem::Project(const std::vector<TEVector2> &points, const TEVector2 &axis, float &min, float &max)
+// Indexed by [CollisionType of a][CollisionType of b]; AABBs and triangles fall back to the polygon routines
+// through their cached outlines
+static const CollideFunction s_CollideTable[4][4] = {
+    /* AABB */ {CollideAABBs, CollidePolygonCircle, CollidePolygons, CollidePolygons},
+    /* Circle */ {CollideCirclePolygon, CollideCircles, CollideCirclePolygon, CollideCirclePolygon},
+    /* Triangle */ {CollidePolygons, CollidePolygonCircle, CollidePolygons, CollidePolygons},
+    /* Polygon */ {CollidePolygons, CollidePolygonCircle, CollidePolygons, CollidePolygons},
+};
+
+bool CollisionSystem::CheckCollision(const CollisionComponent *a, const CollisionComponent *b,
+                                     ContactManifold &manifold)
 {
-    if (points.empty())
-        return;
-    min = max = points[0].x * axis.x + points[0].y * axis.y;
-    for (size_t i = 1; i < points.size(); i++)
-    {
-        float p = points[i].x * axis.x + points[i].y * axis.y;
-        if (p < min)
-            min = p;
-        else if (p > max)
-            max = p;
-    }
+    const CollisionShape &sa = a->shape;
+    const CollisionShape &sb = b->shape;
+    return s_CollideTable[(uint8_t)sa.type][(uint8_t)sb.type](sa, sb, manifold);
 }
 
 } // namespace TE
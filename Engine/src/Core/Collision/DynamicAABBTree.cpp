@@ -0,0 +1,227 @@
+#include "Core/Collision/DynamicAABBTree.hpp"
+#include <algorithm>
+
+namespace TE
+{
+
+int32_t DynamicAABBTree::AllocateNode()
+{
+    if (m_FreeList == NullNode)
+    {
+        m_Nodes.emplace_back();
+        m_Nodes.back().height = 0;
+        return (int32_t)m_Nodes.size() - 1;
+    }
+
+    int32_t node = m_FreeList;
+    m_FreeList = m_Nodes[node].parent;
+    m_Nodes[node] = TreeNode();
+    m_Nodes[node].height = 0;
+    return node;
+}
+
+void DynamicAABBTree::FreeNode(int32_t node)
+{
+    m_Nodes[node].parent = m_FreeList;
+    m_Nodes[node].height = -1;
+    m_FreeList = node;
+}
+
+int32_t DynamicAABBTree::CreateProxy(const BoundsAABB &aabb, uint32_t userData)
+{
+    int32_t proxy = AllocateNode();
+    TreeNode &node = m_Nodes[proxy];
+    node.aabb = {{aabb.min.x - m_Margin, aabb.min.y - m_Margin}, {aabb.max.x + m_Margin, aabb.max.y + m_Margin}};
+    node.userData = userData;
+    InsertLeaf(proxy);
+    return proxy;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxy)
+{
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxy, const BoundsAABB &aabb)
+{
+    if (Contains(m_Nodes[proxy].aabb, aabb))
+        return false;
+
+    RemoveLeaf(proxy);
+    m_Nodes[proxy].aabb = {{aabb.min.x - m_Margin, aabb.min.y - m_Margin},
+                           {aabb.max.x + m_Margin, aabb.max.y + m_Margin}};
+    InsertLeaf(proxy);
+    return true;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+    if (m_Root == NullNode)
+    {
+        m_Root = leaf;
+        m_Nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    // Descend towards the sibling whose subtree grows the least in perimeter
+    const BoundsAABB leafAABB = m_Nodes[leaf].aabb;
+    int32_t index = m_Root;
+    while (!m_Nodes[index].IsLeaf())
+    {
+        const TreeNode &node = m_Nodes[index];
+        float area = Perimeter(node.aabb);
+        float combinedArea = Perimeter(Combine(node.aabb, leafAABB));
+
+        // Cost of making a new parent here, and the minimum cost pushed down to the children
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t child)
+        {
+            BoundsAABB combined = Combine(leafAABB, m_Nodes[child].aabb);
+            float growth = Perimeter(combined);
+            if (!m_Nodes[child].IsLeaf())
+                growth -= Perimeter(m_Nodes[child].aabb);
+            return growth + inheritanceCost;
+        };
+        float cost1 = childCost(node.child1);
+        float cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    int32_t sibling = index;
+    int32_t oldParent = m_Nodes[sibling].parent;
+    int32_t newParent = AllocateNode();
+    m_Nodes[newParent].parent = oldParent;
+    m_Nodes[newParent].aabb = Combine(leafAABB, m_Nodes[sibling].aabb);
+    m_Nodes[newParent].height = m_Nodes[sibling].height + 1;
+    m_Nodes[newParent].child1 = sibling;
+    m_Nodes[newParent].child2 = leaf;
+    m_Nodes[sibling].parent = newParent;
+    m_Nodes[leaf].parent = newParent;
+
+    if (oldParent == NullNode)
+    {
+        m_Root = newParent;
+    }
+    else if (m_Nodes[oldParent].child1 == sibling)
+    {
+        m_Nodes[oldParent].child1 = newParent;
+    }
+    else
+    {
+        m_Nodes[oldParent].child2 = newParent;
+    }
+
+    Refit(m_Nodes[leaf].parent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+    if (leaf == m_Root)
+    {
+        m_Root = NullNode;
+        return;
+    }
+
+    int32_t parent = m_Nodes[leaf].parent;
+    int32_t grandParent = m_Nodes[parent].parent;
+    int32_t sibling = m_Nodes[parent].child1 == leaf ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+    if (grandParent == NullNode)
+    {
+        m_Root = sibling;
+        m_Nodes[sibling].parent = NullNode;
+        FreeNode(parent);
+        return;
+    }
+
+    // The sibling takes the parent's place
+    if (m_Nodes[grandParent].child1 == parent)
+        m_Nodes[grandParent].child1 = sibling;
+    else
+        m_Nodes[grandParent].child2 = sibling;
+    m_Nodes[sibling].parent = grandParent;
+    FreeNode(parent);
+
+    Refit(grandParent);
+}
+
+void DynamicAABBTree::Refit(int32_t index)
+{
+    // Walk to the root fixing bounds and heights, rotating wherever the subtree is unbalanced
+    while (index != NullNode)
+    {
+        index = Balance(index);
+
+        TreeNode &node = m_Nodes[index];
+        node.height = 1 + std::max(m_Nodes[node.child1].height, m_Nodes[node.child2].height);
+        node.aabb = Combine(m_Nodes[node.child1].aabb, m_Nodes[node.child2].aabb);
+
+        index = node.parent;
+    }
+}
+
+int32_t DynamicAABBTree::Balance(int32_t iA)
+{
+    TreeNode *A = &m_Nodes[iA];
+    if (A->IsLeaf() || A->height < 2)
+        return iA;
+
+    int32_t iB = A->child1;
+    int32_t iC = A->child2;
+    int32_t balance = m_Nodes[iC].height - m_Nodes[iB].height;
+
+    // Promotes the taller grandchild-bearing child of A and hands one of its children to A
+    auto rotate = [&](int32_t iUp, int32_t iOther, bool upIsChild2) -> int32_t
+    {
+        TreeNode &up = m_Nodes[iUp];
+        int32_t iF = up.child1;
+        int32_t iG = up.child2;
+
+        // Swap A and up
+        up.child1 = iA;
+        up.parent = m_Nodes[iA].parent;
+        m_Nodes[iA].parent = iUp;
+
+        if (up.parent != NullNode)
+        {
+            if (m_Nodes[up.parent].child1 == iA)
+                m_Nodes[up.parent].child1 = iUp;
+            else
+                m_Nodes[up.parent].child2 = iUp;
+        }
+        else
+        {
+            m_Root = iUp;
+        }
+
+        // Keep the taller grandchild under up, give the shorter one to A
+        int32_t iKeep = m_Nodes[iF].height > m_Nodes[iG].height ? iF : iG;
+        int32_t iGive = iKeep == iF ? iG : iF;
+        up.child2 = iKeep;
+        if (upIsChild2)
+            m_Nodes[iA].child2 = iGive;
+        else
+            m_Nodes[iA].child1 = iGive;
+        m_Nodes[iGive].parent = iA;
+
+        m_Nodes[iA].aabb = Combine(m_Nodes[iOther].aabb, m_Nodes[iGive].aabb);
+        m_Nodes[iA].height = 1 + std::max(m_Nodes[iOther].height, m_Nodes[iGive].height);
+        up.aabb = Combine(m_Nodes[iA].aabb, m_Nodes[iKeep].aabb);
+        up.height = 1 + std::max(m_Nodes[iA].height, m_Nodes[iKeep].height);
+        return iUp;
+    };
+
+    if (balance > 1)
+        return rotate(iC, iB, true);
+    if (balance < -1)
+        return rotate(iB, iC, false);
+    return iA;
+}
+
+} // namespace TE
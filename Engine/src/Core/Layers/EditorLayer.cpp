@@ -16,6 +16,7 @@
 #include "Core/Scene/TagComponent.hpp"
 #include "Core/Scene/TransformComponent.hpp"
 #include "Core/Scene/TriangleComponent.hpp"
+#include "Core/Time/TimeRecorder.hpp"
 #include "Editor/DefaultModes.hpp"
 #include "Editor/EditorToolbar.hpp"
 #include "Editor/SpriteMode.hpp"
@@ -197,6 +198,9 @@ void EditorLayer::OnAttach()
         "TransformComponent", "Parent", "Parent",
         [](void *instance) { return &static_cast<TransformComponent *>(instance)->Parent; });
 
+    // After the registrations above, which decide what the recorder copies
+    ResetTimeRecorder();
+
     LoadSettings();
 
     m_TerminalHistory.push_back("Welcome to TimeEngine Console!");
@@ -223,6 +227,107 @@ void EditorLayer::OnDetach()
     for (auto *body : m_TestBodies)
         delete body;
     m_TestBodies.clear();
+    m_TimeRecorder.reset();
+}
+
+void EditorLayer::ResetTimeRecorder()
+{
+    m_TimeRecorder.reset();
+    m_RewindSecondsAgo = 0.0f;
+    if (!m_ActiveScene || !m_RecordRewind)
+        return;
+
+    m_TimeRecorder = std::make_unique<TimeRecorder>(m_ActiveScene->GetEntityManager());
+    m_TimeRecorder->TrackAllRegistered();
+    m_TimeRecorder->SetPhysicsWorld(m_PhysicsWorld.get());
+}
+
+void EditorLayer::BuildFrameGraph()
+{
+    // Resources are coarse: "Scene" is every component, "EntityIndex" the lookup state EntityManager mutates
+    // from const-looking calls (query caches, the alive list), so passes that query are kept apart
+    m_FrameGraph.Clear();
+
+    m_FrameGraph.AddPass(
+        "Input", {}, {"Camera", "Scene", "Framebuffers"},
+        [this]
+        {
+            UpdateCamera(m_FrameDeltaTime);
+            HandleViewportInput();
+
+            if (m_SaveMessageTimer > 0.0f)
+                m_SaveMessageTimer -= m_FrameDeltaTime;
+
+            if (const FramebufferSpecification &spec = m_Framebuffer->GetSpecification();
+                m_ViewportSizeChanged && spec.Width > 0 && spec.Height > 0 &&
+                (spec.Width != m_LastViewportX || spec.Height != m_LastViewportY))
+            {
+                m_Framebuffer->Resize((uint32_t)m_LastViewportX, (uint32_t)m_LastViewportY);
+                if (m_LightMapFramebuffer)
+                    m_LightMapFramebuffer->Resize((uint32_t)m_LastViewportX, (uint32_t)m_LastViewportY);
+                m_ViewportSizeChanged = false;
+            }
+        },
+        true);
+
+    // Physics runs at its fixed tick rate regardless of the display rate; it only touches its own bodies
+    m_FrameGraph.AddPass("Physics", {}, {"Physics"},
+                         [this]
+                         {
+                             if (m_PhysicsWorld && m_RewindSecondsAgo <= 0.0f)
+                                 m_PhysicsWorld->Advance(m_FrameDeltaTime);
+                         });
+
+    m_FrameGraph.AddPass("Recorder", {"Scene", "Physics"}, {"Recorder"},
+                         [this]
+                         {
+                             if (m_TimeRecorder && m_RewindSecondsAgo <= 0.0f)
+                                 m_TimeRecorder->Update(m_FrameDeltaTime);
+                         });
+
+    m_FrameGraph.AddPass(
+        "EditorMode", {}, {"Camera", "Scene"},
+        [this]
+        {
+            if (EditorMode *activeMode = EditorModeRegistry::GetActiveMode())
+                activeMode->OnUpdate(m_FrameDeltaTime);
+        },
+        true);
+
+    // World matrices for every pass below; only edited subtrees are recomputed
+    m_FrameGraph.AddPass("Transforms", {"Scene"}, {"Transforms", "EntityIndex"},
+                         [this]
+                         {
+                             if (m_ActiveScene)
+                                 m_ActiveScene->GetTransformSystem().Update();
+                         });
+
+    m_FrameGraph.AddPass("Ambient", {"Scene"}, {"Ambient", "EntityIndex"},
+                         [this]
+                         {
+                             m_FrameAmbient = nullptr;
+                             if (!m_ActiveScene)
+                                 return;
+                             for (auto [id, amb] : m_ActiveScene->GetEntityManager().Query<AmbientLightComponent>())
+                             {
+                                 m_FrameAmbient = &amb;
+                                 break;
+                             }
+                         });
+
+    m_FrameGraph.AddPass("Lights", {"Scene", "Transforms"}, {"Lights", "EntityIndex"},
+                         [this] { CollectSceneLights(); });
+    m_FrameGraph.AddPass("Occluders", {"Scene", "Transforms"}, {"Occluders"}, [this] { UpdateShadowOccluders(); });
+
+    m_FrameGraph.AddPass("LightMap", {"Camera", "Ambient", "Lights", "Occluders"}, {"Framebuffers"},
+                         [this] { RenderLightMap(); }, true);
+    m_FrameGraph.AddPass("SceneRender", {"Camera", "Physics", "Scene", "Transforms"}, {"Framebuffers"},
+                         [this] { RenderScene(); }, true);
+}
+
+bool EditorLayer::IsLightMapEnabled() const
+{
+    return m_LightMapFramebuffer && m_LightBlendMaterial && m_Renderer2D && m_ActiveScene;
 }
 
 void EditorLayer::OnUpdate()
@@ -232,183 +337,171 @@ void EditorLayer::OnUpdate()
     float dt = TimeGUI::GetIO().DeltaTime;
     if (dt > 0.05f)
         dt = 0.05f; // Clamp
+    m_FrameDeltaTime = dt;
 
-    UpdateCamera(dt);
-    HandleViewportInput();
-
-    if (m_SaveMessageTimer > 0.0f)
-        m_SaveMessageTimer -= dt;
-
-    // Physics Step
-    if (m_PhysicsWorld)
-        m_PhysicsWorld->Step(dt);
+    if (m_FrameGraph.GetPassCount() == 0)
+        BuildFrameGraph();
+    m_FrameGraph.Execute();
 
-    if (const FramebufferSpecification &spec = m_Framebuffer->GetSpecification();
-        m_ViewportSizeChanged && spec.Width > 0 && spec.Height > 0 &&
-        (spec.Width != m_LastViewportX || spec.Height != m_LastViewportY))
+    auto endTime = std::chrono::high_resolution_clock::now();
+    float durationMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    if (m_ProfilingLayer)
     {
-        m_Framebuffer->Resize((uint32_t)m_LastViewportX, (uint32_t)m_LastViewportY);
-        if (m_LightMapFramebuffer)
-            m_LightMapFramebuffer->Resize((uint32_t)m_LastViewportX, (uint32_t)m_LastViewportY);
-        m_ViewportSizeChanged = false;
+        m_ProfilingLayer->RecordGameTime(durationMs);
+        m_ProfilingLayer->RecordFrameTimeline(m_FrameGraph.GetTimeline(), m_FrameGraph.GetLastFrameMs());
     }
+}
 
-    // Update Active Mode
-    if (EditorMode *activeMode = EditorModeRegistry::GetActiveMode())
-        activeMode->OnUpdate(dt);
+void EditorLayer::CollectSceneLights()
+{
+    m_SceneLights.clear();
+    if (!IsLightMapEnabled())
+        return;
 
-    // 1. LightMap Pass
-    if (m_LightMapFramebuffer && m_LightBlendMaterial)
-    {
-        m_LightMapFramebuffer->Bind();
+    auto &entityManager = m_ActiveScene->GetEntityManager();
+    const TransformSystem &transforms = m_ActiveScene->GetTransformSystem();
 
-        // Default to very dim (0.1) if no AmbientLight exists in the scene.
-        // This makes the scene faintly visible while making Point Lights pop brightly.
-        TEColor ambientClear(0.1f, 0.1f, 0.1f, 1.0f);
-        bool hasAmbient = false;
-        if (m_ActiveScene)
+    // The cached query only visits entities that own both components
+    entityManager.Query<TransformComponent, LightComponent>().Each(
+        [&](EntityID id, TransformComponent &, LightComponent &)
         {
-            auto &entityManager = m_ActiveScene->GetEntityManager();
-            const auto &entities = entityManager.GetAliveEntities();
-            for (EntityID id : entities)
-            {
-                auto ambients = entityManager.GetComponents<AmbientLightComponent>(Entity(id));
-                if (!ambients.empty())
+            entityManager.ForEachComponent<LightComponent>(
+                id,
+                [&](LightComponent &light)
                 {
-                    auto *amb = ambients[0];
-                    float intsy = amb->Intensity;
-                    ambientClear = TEColor(amb->SkyColor.GetValue().r * intsy, amb->SkyColor.GetValue().g * intsy,
-                                           amb->SkyColor.GetValue().b * intsy, 1.0f);
+                    TEMatrix4 worldMat = transforms.GetWorldMatrix(&light);
+                    float rotation = atan2(worldMat.m[0][1], worldMat.m[0][0]);
+                    m_SceneLights.push_back(
+                        {TEVector2(worldMat.m[3][0], worldMat.m[3][1]), light.Radius, rotation, &light});
+                });
+        });
+}
 
-                    if (m_Renderer2D)
-                    {
-                        m_Renderer2D->SetAmbientGradient(amb->SkyColor, amb->HorizonColor, amb->GroundColor,
-                                                         amb->Intensity, amb->HorizonHeight, amb->HorizonSpread);
-                    }
+void EditorLayer::UpdateShadowOccluders()
+{
+    if (!IsLightMapEnabled())
+        return;
 
-                    hasAmbient = true;
-                    break;
-                }
-            }
+    const uint64_t frame = ++m_LightMapFrame;
+    const TransformSystem &transforms = m_ActiveScene->GetTransformSystem();
+
+    // Collect shadow-casting geometry generically, streaming over the cached hierarchy
+    for (size_t node = 0; node < transforms.GetNodeCount(); ++node)
+    {
+        TComponent *comp = transforms.GetNode(node);
+        if (!comp->CastsOcclusionShadow())
+            continue;
+
+        const TEMatrix4 &model = transforms.GetNodeWorldMatrix(node);
+        OcclusionShape shape;
+        bool hasShape = comp->GetOcclusionShape(shape);
+
+        auto [it, inserted] = m_OccluderCache.try_emplace(comp);
+        CachedOccluder &cached = it->second;
+        if (inserted)
+        {
+            cached.Slot = (uint32_t)m_ShadowOccluders.size();
+            m_ShadowOccluders.emplace_back();
+            m_ShadowOccluderOwners.push_back(comp);
         }
+        cached.LastFrame = frame;
 
-        RenderCommand::SetClearColor(
-            {ambientClear.GetValue().r, ambientClear.GetValue().g, ambientClear.GetValue().b, 1.0f});
-        RenderCommand::Clear();
+        // Hull and bounds are only rebuilt when the transform or shape parameters changed
+        bool dirty = inserted || !hasShape || !cached.HasShape || cached.Shape != shape || cached.Model != model;
+        if (dirty)
+        {
+            cached.Model = model;
+            cached.Shape = shape;
+            cached.HasShape = hasShape;
+            Renderer2D::BuildShadowHull(comp->GetWorldVertices(model), m_ShadowOccluders[cached.Slot]);
+        }
+    }
 
-        if (m_Renderer2D && m_ActiveScene)
+    // Drop casters that were not seen this frame (destroyed or no longer casting); swap-remove keeps
+    // the occluder array dense
+    for (size_t slot = 0; slot < m_ShadowOccluders.size();)
+    {
+        auto it = m_OccluderCache.find(m_ShadowOccluderOwners[slot]);
+        if (it->second.LastFrame == frame)
         {
-            float aspect = (m_LastViewportY > 0) ? (float)m_LastViewportX / (float)m_LastViewportY : 1.0f;
-            float zoom = m_CameraZoom;
-            TEMatrix4 projection = TEMatrix4::Ortho(-aspect * zoom, aspect * zoom, -zoom, zoom, -1.0f, 1.0f);
-            TEMatrix4 view =
-                TEMatrix4::Translate(TEMatrix4(1.0f), TEVector(-m_CameraPosition.x, -m_CameraPosition.y, 0.0f));
-            TEMatrix4 viewProj = projection * view;
+            ++slot;
+            continue;
+        }
+        m_OccluderCache.erase(it);
+        if (slot + 1 != m_ShadowOccluders.size())
+        {
+            m_ShadowOccluders[slot] = std::move(m_ShadowOccluders.back());
+            m_ShadowOccluderOwners[slot] = m_ShadowOccluderOwners.back();
+            m_OccluderCache[m_ShadowOccluderOwners[slot]].Slot = (uint32_t)slot;
+        }
+        m_ShadowOccluders.pop_back();
+        m_ShadowOccluderOwners.pop_back();
+    }
 
-            m_Renderer2D->BeginFrame(viewProj);
-            auto &entityManager = m_ActiveScene->GetEntityManager();
-            const auto &entities = entityManager.GetAliveEntities();
+    m_ShadowOccluderGrid.Build(m_ShadowOccluders.data(), m_ShadowOccluders.size());
+}
 
-            // Collect lights and shadow-casting occluders
-            struct LightInfo
-            {
-                TEVector2 pos;
-                float radius;
-                float rotation;
-                LightComponent *comp;
-            };
-            std::vector<LightInfo> sceneLights;
-            struct OccluderInfo
-            {
-                std::vector<TEVector2> vertices;
-                float radiusScale;
-                TEVector2 center;
-            };
-            std::vector<OccluderInfo> occluders;
+void EditorLayer::RenderLightMap()
+{
+    if (!m_LightMapFramebuffer || !m_LightBlendMaterial)
+        return;
 
-            for (EntityID id : entities)
-            {
-                Entity entity(id);
-                auto *transform = entityManager.GetComponent<TransformComponent>(entity);
-                if (!transform)
-                    continue;
+    m_LightMapFramebuffer->Bind();
 
-                auto GetWorldTransform = [&](TComponent *comp) -> TEMatrix4
-                {
-                    std::vector<TComponent *> chain;
-                    TComponent *curr = comp;
-                    while (curr)
-                    {
-                        chain.push_back(curr);
-                        curr = curr->GetParentComponent();
-                    }
-                    std::reverse(chain.begin(), chain.end());
-                    TEMatrix4 model = transform->Transform.GetMatrix();
-                    for (auto *node : chain)
-                    {
-                        model = model * node->Transform.GetMatrix();
-                    }
-                    return model;
-                };
+    // Default to very dim (0.1) if no AmbientLight exists in the scene.
+    // This makes the scene faintly visible while making Point Lights pop brightly.
+    TEColor ambientClear(0.1f, 0.1f, 0.1f, 1.0f);
+    if (const AmbientLightComponent *amb = m_FrameAmbient)
+    {
+        float intsy = amb->Intensity;
+        ambientClear = TEColor(amb->SkyColor.GetValue().r * intsy, amb->SkyColor.GetValue().g * intsy,
+                               amb->SkyColor.GetValue().b * intsy, 1.0f);
 
-                // Collect lights
-                auto lights = entityManager.GetComponents<LightComponent>(entity);
-                for (auto *light : lights)
-                {
-                    TEMatrix4 worldMat = GetWorldTransform(light);
-                    float rotation = atan2(worldMat.m[0][1], worldMat.m[0][0]);
-                    sceneLights.push_back(
-                        {TEVector2(worldMat.m[3][0], worldMat.m[3][1]), light->Radius, rotation, light});
-                }
+        if (m_Renderer2D)
+        {
+            m_Renderer2D->SetAmbientGradient(amb->SkyColor, amb->HorizonColor, amb->GroundColor, amb->Intensity,
+                                             amb->HorizonHeight, amb->HorizonSpread);
+        }
+    }
 
-                // Collect shadow-casting geometry generically
-                auto allComponents = entityManager.GetAllComponents(entity);
-                for (auto *comp : allComponents)
-                {
-                    if (comp->CastsOcclusionShadow())
-                    {
-                        TEMatrix4 model = GetWorldTransform(comp);
-                        std::vector<TEVector2> verts = comp->GetWorldVertices(model);
-                        if (!verts.empty())
-                        {
-                            // Approximate radius scale for culling (from model matrix scale)
-                            float rScale = std::sqrt(model.m[0][0] * model.m[0][0] + model.m[0][1] * model.m[0][1] +
-                                                     model.m[0][2] * model.m[0][2]);
-                            occluders.push_back({verts, rScale, TEVector2(model.m[3][0], model.m[3][1])});
-                        }
-                    }
-                }
-            }
+    RenderCommand::SetClearColor(
+        {ambientClear.GetValue().r, ambientClear.GetValue().g, ambientClear.GetValue().b, 1.0f});
+    RenderCommand::Clear();
 
-            // 1a. Draw all lights into lightmap
-            for (auto &li : sceneLights)
-            {
-                m_Renderer2D->SubmitLight(*li.comp, li.pos, li.rotation);
-            }
+    if (m_Renderer2D && m_ActiveScene)
+    {
+        float aspect = (m_LastViewportY > 0) ? (float)m_LastViewportX / (float)m_LastViewportY : 1.0f;
+        float zoom = m_CameraZoom;
+        TEMatrix4 projection = TEMatrix4::Ortho(-aspect * zoom, aspect * zoom, -zoom, zoom, -1.0f, 1.0f);
+        TEMatrix4 view =
+            TEMatrix4::Translate(TEMatrix4(1.0f), TEVector(-m_CameraPosition.x, -m_CameraPosition.y, 0.0f));
+        TEMatrix4 viewProj = projection * view;
 
-            // 1b. Draw shadow volumes for each light-occluder pair
-            for (auto &li : sceneLights)
-            {
-                for (auto &occ : occluders)
-                {
-                    // Quick distance check
-                    float dx = occ.center.x - li.pos.x;
-                    float dy = occ.center.y - li.pos.y;
-                    float distSq = dx * dx + dy * dy;
-                    float maxDist = li.radius + occ.radiusScale;
-                    if (distSq > maxDist * maxDist)
-                        continue;
+        m_Renderer2D->BeginFrame(viewProj);
 
-                    m_Renderer2D->SubmitShadow(li.pos, li.radius, occ.vertices);
-                }
-            }
+        // 1a. Draw all lights into lightmap
+        for (auto &li : m_SceneLights)
+        {
+            m_Renderer2D->SubmitLight(*li.comp, li.pos, li.rotation);
+        }
 
-            m_Renderer2D->EndFrame();
-            m_Renderer2D->Flush();
+        // 1b. Draw shadow volumes, each light only visiting the occluders in its grid cells
+        for (auto &li : m_SceneLights)
+        {
+            m_VisibleOccluders.clear();
+            m_ShadowOccluderGrid.Query(li.pos, li.radius, m_VisibleOccluders);
+            m_Renderer2D->SubmitShadows(li.pos, li.radius, m_ShadowOccluders.data(), m_VisibleOccluders.data(),
+                                        m_VisibleOccluders.size());
         }
-        m_LightMapFramebuffer->Unbind();
+
+        m_Renderer2D->EndFrame();
+        m_Renderer2D->Flush();
     }
+    m_LightMapFramebuffer->Unbind();
+}
 
+void EditorLayer::RenderScene()
+{
     // 2. Main Scene Pass
     m_Framebuffer->Bind();
     RenderCommand::SetClearColor({0.1f, 0.1f, 0.1f, 1.0f});
@@ -438,7 +531,7 @@ void EditorLayer::OnUpdate()
                 {
                     TEVector2 size = body->Shape.aabb.max - body->Shape.aabb.min;
                     TEVector2 localCenter = (body->Shape.aabb.min + body->Shape.aabb.max) * 0.5f;
-                    TEVector2 worldCenter = body->Position + localCenter;
+                    TEVector2 worldCenter = m_PhysicsWorld->GetInterpolatedPosition(*body) + localCenter;
 
                     TEVector2 pos = {worldCenter.x - size.x * 0.5f, worldCenter.y - size.y * 0.5f};
                     TEVector2 sz = {size.x, size.y};
@@ -451,41 +544,13 @@ void EditorLayer::OnUpdate()
         // Scene Rendering
         if (m_ActiveScene)
         {
-            auto &entityManager = m_ActiveScene->GetEntityManager();
-            const auto &entities = entityManager.GetAliveEntities();
-            for (EntityID id : entities)
+            // The hierarchy is in entity creation order, so equal-depth sprites keep their submission order
+            const TransformSystem &transforms = m_ActiveScene->GetTransformSystem();
+            for (size_t node = 0; node < transforms.GetNodeCount(); ++node)
             {
-                Entity entity(id);
-                auto *transform = entityManager.GetComponent<TransformComponent>(entity);
-                if (!transform)
-                    continue;
-
-                auto GetWorldTransform = [&](TComponent *comp) -> TEMatrix4
-                {
-                    std::vector<TComponent *> chain;
-                    TComponent *curr = comp;
-                    while (curr)
-                    {
-                        chain.push_back(curr);
-                        curr = curr->GetParentComponent();
-                    }
-                    std::reverse(chain.begin(), chain.end());
-
-                    TEMatrix4 model = transform->Transform.GetMatrix();
-                    for (auto *node : chain)
-                    {
-                        model = model * node->Transform.GetMatrix();
-                    }
-                    return model;
-                };
-
                 // Generic Rendering
-                auto allComponents = entityManager.GetAllComponents(entity);
-                for (auto *comp : allComponents)
-                {
-                    TEMatrix4 model = GetWorldTransform(comp);
-                    comp->OnRender(m_Renderer2D.get(), model, m_DebugMaterial);
-                }
+                transforms.GetNode(node)->OnRender(m_Renderer2D.get(), transforms.GetNodeWorldMatrix(node),
+                                                   m_DebugMaterial);
             }
         }
 
@@ -514,13 +579,6 @@ void EditorLayer::OnUpdate()
     }
 
     m_Framebuffer->Unbind();
-
-    auto endTime = std::chrono::high_resolution_clock::now();
-    float durationMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-    if (m_ProfilingLayer)
-    {
-        m_ProfilingLayer->RecordGameTime(durationMs);
-    }
 }
 
 void EditorLayer::OnEvent(Event &event)
@@ -736,6 +794,7 @@ void EditorLayer::OnTimeGUIRender()
         UI_DrawSettingsPanel();
         UI_DrawProjectSettingsPanel();
         UI_DrawPluginsPanel();
+        UI_DrawRewindPanel();
     }
 
     ProcessDeletionQueues();
@@ -802,6 +861,7 @@ void EditorLayer::UI_DrawMenubar()
             TimeGUI::MenuItem("Properties", "", &m_ShowProperties);
             TimeGUI::MenuItem("Content Browser", "", &m_ShowContentBrowser);
             TimeGUI::MenuItem("Console & Terminal", "", &m_ShowConsolePanel);
+            TimeGUI::MenuItem("Rewind", "", &m_ShowRewindPanel);
             TimeGUI::EndMenu();
         }
         TimeGUI::EndMenuBar();
@@ -820,7 +880,8 @@ void EditorLayer::UI_DrawSceneHierarchy()
     {
         TimeGUI::PushStyleVar(TimeGUIStyleVar_ItemSpacing, TEVector2(8, 12));
         auto &entityManager = m_ActiveScene->GetEntityManager();
-        const auto &aliveEntities = entityManager.GetAliveEntities();
+        // Copied: the context menus below can create or destroy entities mid-iteration
+        const std::vector<EntityID> aliveEntities = entityManager.GetAliveEntities();
 
         auto DrawEntityNode = [&](auto &&self, Entity entity) -> void
         {
@@ -2289,6 +2350,48 @@ void EditorLayer::UI_DrawPluginsPanel()
     TimeGUI::End();
 }
 
+void EditorLayer::UI_DrawRewindPanel()
+{
+    if (!m_ShowRewindPanel)
+        return;
+
+    TimeGUI::Begin("Rewind", &m_ShowRewindPanel);
+
+    // The recorder and its buffer only exist while recording
+    if (TimeGUI::Checkbox("Record", &m_RecordRewind))
+        ResetTimeRecorder();
+
+    if (!m_TimeRecorder)
+    {
+        TimeGUI::TextDisabled("Recording is off.");
+        TimeGUI::End();
+        return;
+    }
+
+    // Scrubbing keeps the newer frames and only moves components, so the slider can move forward again and the
+    // physics world is rebuilt once, when a resume drops them
+    float recorded = m_TimeRecorder->GetRecordedSeconds();
+    if (TimeGUI::SliderFloat("Seconds Ago", &m_RewindSecondsAgo, 0.0f, recorded, "%.2f"))
+        m_TimeRecorder->Scrub(m_RewindSecondsAgo);
+
+    TimeGUI::BeginDisabled(m_RewindSecondsAgo <= 0.0f);
+    if (TimeGUI::Button("Resume From Here"))
+    {
+        m_TimeRecorder->Rewind(m_RewindSecondsAgo);
+        m_RewindSecondsAgo = 0.0f;
+    }
+    TimeGUI::SameLine();
+    if (TimeGUI::Button("Back to Live"))
+    {
+        m_TimeRecorder->Scrub(0.0f);
+        m_RewindSecondsAgo = 0.0f;
+    }
+    TimeGUI::EndDisabled();
+
+    TimeGUI::Text("Recorded: %.1f s, %.1f KB/s", recorded, m_TimeRecorder->GetMemoryPerSecond() / 1024.0f);
+    TimeGUI::End();
+}
+
 void EditorLayer::UI_DrawConsolePanel()
 {
     if (!m_ShowConsolePanel)
@@ -2473,6 +2576,7 @@ void EditorLayer::ExecuteTerminalCommand(const std::string &commandLine)
         m_TerminalHistory.push_back("  list_entities     - List all active entities in the current scene.");
         m_TerminalHistory.push_back("  create_entity <N> - Create a new entity with name <N>.");
         m_TerminalHistory.push_back("  destroy_entity <I>- Destroy the entity with ID <I>.");
+        m_TerminalHistory.push_back("  physics_verify <N>- Check N physics steps replay the same after a restore.");
         m_TerminalHistory.push_back("  [system commands] - Any other command will run in the project root directory.");
     }
     else if (commandLine == "clear")
@@ -2542,6 +2646,28 @@ void EditorLayer::ExecuteTerminalCommand(const std::string &commandLine)
             m_TerminalHistory.push_back("Error: No active scene loaded.");
         }
     }
+    else if (commandLine == "physics_verify" || commandLine.rfind("physics_verify ", 0) == 0)
+    {
+        int steps = 120;
+        try
+        {
+            if (commandLine.size() > 15)
+                steps = std::stoi(commandLine.substr(15));
+        }
+        catch (...)
+        {
+            steps = -1;
+        }
+
+        if (!m_PhysicsWorld)
+            m_TerminalHistory.push_back("Error: No physics world.");
+        else if (steps <= 0)
+            m_TerminalHistory.push_back("Error: Invalid step count.");
+        else if (m_PhysicsWorld->VerifyRestore(steps))
+            m_TerminalHistory.push_back("Restore check passed after " + std::to_string(steps) + " steps.");
+        else
+            m_TerminalHistory.push_back("Restore check failed, see the log.");
+    }
     else
     {
         // Run system command in project directory
@@ -2616,26 +2742,7 @@ void EditorLayer::HandleViewportInput()
             worldMouse.y = (1.0f - (viewportMouse.y / m_LastViewportY) * 2.0f) * zoom + m_CameraPosition.y;
 
             auto &entityManager = m_ActiveScene->GetEntityManager();
-            auto GetWorldTransform = [&](Entity e, TComponent *comp) -> TEMatrix4
-            {
-                auto *transform = entityManager.GetComponent<TransformComponent>(e);
-                if (!transform)
-                    return TEMatrix4(1.0f);
-                std::vector<TComponent *> chain;
-                TComponent *curr = comp;
-                while (curr)
-                {
-                    chain.push_back(curr);
-                    curr = curr->GetParentComponent();
-                }
-                std::reverse(chain.begin(), chain.end());
-                TEMatrix4 model = transform->Transform.GetMatrix();
-                for (auto *node : chain)
-                {
-                    model = model * node->Transform.GetMatrix();
-                }
-                return model;
-            };
+            const TransformSystem &transforms = m_ActiveScene->GetTransformSystem();
 
             std::vector<Entity> candidates;
             for (auto entityID : entityManager.GetAliveEntities())
@@ -2645,7 +2752,7 @@ void EditorLayer::HandleViewportInput()
                 auto allComponents = entityManager.GetAllComponents(entity);
                 for (auto *comp : allComponents)
                 {
-                    TEMatrix4 model = GetWorldTransform(entity, comp);
+                    TEMatrix4 model = transforms.GetWorldMatrix(comp);
                     if (comp->ContainsPoint(model, worldMouse))
                     {
                         hit = true;
@@ -3806,6 +3913,7 @@ void EditorLayer::LoadScene(const std::filesystem::path &filepath)
     try
     {
         m_ActiveScene = std::make_shared<Scene>();
+        ResetTimeRecorder();
         SceneSerializer serializer(m_ActiveScene);
         if (serializer.Deserialize(filepath))
         {
@@ -30,6 +30,7 @@ void ProfilingLayer::TrackClassAllocation(const std::string &className, size_t s
 {
     if (s_Instance)
     {
+        std::lock_guard<std::mutex> lock(s_Instance->m_TrackingMutex);
         auto &alloc = s_Instance->m_ClassAllocations[className];
         alloc.className = className;
         alloc.count++;
@@ -42,6 +43,7 @@ void ProfilingLayer::TrackClassDeallocation(const std::string &className, size_t
 {
     if (s_Instance)
     {
+        std::lock_guard<std::mutex> lock(s_Instance->m_TrackingMutex);
         auto it = s_Instance->m_ClassAllocations.find(className);
         if (it != s_Instance->m_ClassAllocations.end())
         {
@@ -59,6 +61,7 @@ void ProfilingLayer::PushStackFrame(const std::string &functionName, size_t size
 {
     if (s_Instance)
     {
+        std::lock_guard<std::mutex> lock(s_Instance->m_TrackingMutex);
         s_Instance->m_ActiveStackFrames[functionName] = sizeBytes;
     }
 }
@@ -67,6 +70,7 @@ void ProfilingLayer::PopStackFrame(const std::string &functionName)
 {
     if (s_Instance)
     {
+        std::lock_guard<std::mutex> lock(s_Instance->m_TrackingMutex);
         s_Instance->m_ActiveStackFrames.erase(functionName);
     }
 }
@@ -143,6 +147,9 @@ void ProfilingLayer::EndFrame()
     m_CurrentMetrics.vertices = 0;
     m_CurrentMetrics.textures = 0;
     m_CurrentMetrics.shaders = 0;
+    m_CurrentMetrics.shaderBinds = 0;
+    m_CurrentMetrics.materialBinds = 0;
+    m_CurrentMetrics.blendChanges = 0;
 }
 
 void ProfilingLayer::ResetCountersIfNewFrame()
@@ -184,6 +191,14 @@ void ProfilingLayer::RecordShader(uint32_t count)
     m_CurrentMetrics.shaders += count;
 }
 
+void ProfilingLayer::RecordStateChanges(uint32_t shaderBinds, uint32_t materialBinds, uint32_t blendChanges)
+{
+    ResetCountersIfNewFrame();
+    m_CurrentMetrics.shaderBinds += shaderBinds;
+    m_CurrentMetrics.materialBinds += materialBinds;
+    m_CurrentMetrics.blendChanges += blendChanges;
+}
+
 void ProfilingLayer::UpdateMetrics()
 {
     UpdateSystemMetrics();
@@ -203,6 +218,7 @@ void ProfilingLayer::UpdateMetrics()
     m_UITimeHistory.push_back(m_CurrentMetrics.uiTime);
 
     // Calculate dynamic memory totals
+    std::unique_lock<std::mutex> trackingLock(m_TrackingMutex);
     size_t totalHeapBytes = 0;
     for (const auto &pair : m_ClassAllocations)
         totalHeapBytes += pair.second.sizeBytes;
@@ -212,6 +228,7 @@ void ProfilingLayer::UpdateMetrics()
     size_t totalStackBytes = 0;
     for (const auto &pair : m_ActiveStackFrames)
         totalStackBytes += pair.second;
+    trackingLock.unlock();
     float stackKB = (float)totalStackBytes / 1024.0f;
     m_StackHistory.push_back(stackKB);
 
@@ -414,6 +431,11 @@ void ProfilingLayer::RenderPerformanceWindow()
                 RenderMemoryInfo();
                 TimeGUI::EndTabItem();
             }
+            if (TimeGUI::BeginTabItem("Frame"))
+            {
+                RenderFrameTimeline();
+                TimeGUI::EndTabItem();
+            }
             if (TimeGUI::BeginTabItem("Graphs"))
             {
                 RenderPerformanceGraphs();
@@ -595,6 +617,19 @@ void ProfilingLayer::RenderRenderingInfo()
     TimeGUI::SameLine();
     TimeGUI::TextColored(m_CPUColor, "%u", m_CurrentMetrics.shaders);
 
+    // State changes issued by the batcher (lower is better)
+    TimeGUI::Text("Shader Binds: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_CPUColor, "%u", m_CurrentMetrics.shaderBinds);
+
+    TimeGUI::Text("Material Binds: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_CPUColor, "%u", m_CurrentMetrics.materialBinds);
+
+    TimeGUI::Text("Blend Changes: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_CPUColor, "%u", m_CurrentMetrics.blendChanges);
+
     TimeGUI::Separator();
 
     // Performance metrics
@@ -622,6 +657,21 @@ void ProfilingLayer::RenderMemoryInfo()
 
     TimeGUI::Separator();
 
+    // Rewind history
+    TimeGUI::Text("Rewind History: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_RAMColor, "%.1f s", m_CurrentMetrics.rewindSeconds);
+
+    TimeGUI::Text("Rewind Memory: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_RAMColor, "%s/s", FormatBytes((uint64_t)m_CurrentMetrics.rewindBytesPerSecond).c_str());
+
+    TimeGUI::Text("Rewind Restore: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_RAMColor, "%.3f ms", m_CurrentMetrics.rewindRestoreTime);
+
+    TimeGUI::Separator();
+
     // Memory warnings
     if (m_CurrentMetrics.ramUsage > 90.0f)
     {
@@ -651,6 +701,7 @@ void ProfilingLayer::RenderMemoryInfo()
     TimeGUI::Separator();
 
     // Class Allocations Table (Heap)
+    std::lock_guard<std::mutex> trackingLock(m_TrackingMutex);
     TimeGUI::Text("Class Allocations (Heap)");
     if (TimeGUI::BeginTable("ClassAllocationsTable", 3, 1))
     {
@@ -705,6 +756,86 @@ void ProfilingLayer::RenderMemoryInfo()
     }
 }
 
+void ProfilingLayer::RenderFrameTimeline()
+{
+    if (m_FrameTimeline.empty())
+    {
+        TimeGUI::Text("No frame graph has run yet.");
+        return;
+    }
+
+    TimeGUI::Text("Frame Graph: ");
+    TimeGUI::SameLine();
+    TimeGUI::TextColored(m_FPSColor, "%.3f ms", m_FrameTimelineMs);
+
+    // One lane per thread that ran a pass, bars placed by start time
+    int lanes = 1;
+    for (const auto &entry : m_FrameTimeline)
+        lanes = std::max(lanes, entry.Thread + 1);
+
+    const float laneHeight = 18.0f;
+    TEVector2 pos = TimeGUI::GetCursorScreenPos();
+    TEVector2 size = TEVector2(TimeGUI::GetContentRegionAvail().x, laneHeight * lanes);
+    float scale = m_FrameTimelineMs > 0.0f ? size.x / m_FrameTimelineMs : 0.0f;
+
+    TimeGUI::TimeGUIDrawList drawList = TimeGUI::GetWindowDrawList();
+    drawList.AddRectFilled(pos, TEVector2(pos.x + size.x, pos.y + size.y), IM_COL32(20, 20, 20, 255));
+
+    TEVector2 mouse = TimeGUI::GetMousePos();
+    const FrameTimelineEntry *hovered = nullptr;
+    for (size_t i = 0; i < m_FrameTimeline.size(); i++)
+    {
+        const auto &entry = m_FrameTimeline[i];
+        TEVector2 min(pos.x + entry.StartMs * scale, pos.y + entry.Thread * laneHeight + 1.0f);
+        TEVector2 max(std::max(pos.x + entry.EndMs * scale, min.x + 1.0f), min.y + laneHeight - 2.0f);
+
+        // Spread the hue over the passes so neighbours stay distinguishable
+        float hue = (float)i / (float)m_FrameTimeline.size();
+        unsigned int color = IM_COL32(80 + (int)(hue * 150), 200 - (int)(hue * 120), 120 + (int)(hue * 100), 255);
+        drawList.AddRectFilled(min, max, color);
+        if (max.x - min.x > 40.0f)
+            drawList.AddText(TEVector2(min.x + 2.0f, min.y + 1.0f), IM_COL32(0, 0, 0, 255), entry.Name);
+
+        if (mouse.x >= min.x && mouse.x <= max.x && mouse.y >= min.y && mouse.y <= max.y)
+            hovered = &entry;
+    }
+    drawList.AddRect(pos, TEVector2(pos.x + size.x, pos.y + size.y), IM_COL32(100, 100, 100, 255));
+
+    if (hovered)
+    {
+        TimeGUI::SetTooltip(hovered->Name + ": " + std::to_string(hovered->EndMs - hovered->StartMs) + " ms");
+    }
+
+    TimeGUI::SetCursorScreenPos(TEVector2(pos.x, pos.y + size.y + 5));
+    TimeGUI::Separator();
+
+    if (TimeGUI::BeginTable("FrameTimelineTable", 4, 1))
+    {
+        TimeGUI::TableSetupColumn("Pass");
+        TimeGUI::TableSetupColumn("Thread");
+        TimeGUI::TableSetupColumn("Start");
+        TimeGUI::TableSetupColumn("Duration");
+        TimeGUI::TableHeadersRow();
+
+        for (const auto &entry : m_FrameTimeline)
+        {
+            TimeGUI::TableNextRow();
+            TimeGUI::TableNextColumn();
+            TimeGUI::Text("%s", entry.Name.c_str());
+            TimeGUI::TableNextColumn();
+            if (entry.Thread == 0)
+                TimeGUI::Text("Main");
+            else
+                TimeGUI::Text("Worker %d", entry.Thread);
+            TimeGUI::TableNextColumn();
+            TimeGUI::Text("%.3f ms", entry.StartMs);
+            TimeGUI::TableNextColumn();
+            TimeGUI::Text("%.3f ms", entry.EndMs - entry.StartMs);
+        }
+        TimeGUI::EndTable();
+    }
+}
+
 void ProfilingLayer::RenderPerformanceGraphs()
 {
     if (!m_ShowGraphs)
@@ -0,0 +1,121 @@
+#include "Core/Physics/PhysicsStateHistory.hpp"
+#include "Core/Time/DeltaCodec.hpp"
+
+namespace TE
+{
+
+PhysicsStateHistory::PhysicsStateHistory(size_t capacity, size_t keyframeInterval)
+    : m_Entries(capacity > 0 ? capacity : 1), m_KeyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1)
+{
+}
+
+void PhysicsStateHistory::Push(const std::vector<uint8_t> &state)
+{
+    bool full = m_Count == m_Entries.size();
+    if (full && m_Count > 1)
+    {
+        // The oldest snapshot is about to be overwritten; the one after it must become self-contained first
+        Entry &next = m_Entries[Slot(m_Count - 2)];
+        if (!next.Keyframe)
+        {
+            std::vector<uint8_t> whole;
+            Reconstruct(m_Count - 2, whole);
+            next.Data.swap(whole);
+            next.Keyframe = true;
+        }
+    }
+
+    // Fresh buffers, so a slot that used to hold a keyframe does not keep its capacity for a small delta
+    std::vector<uint8_t> data;
+    bool keyframe = m_Count == 0 || m_Entries.size() == 1 || m_SinceKeyframe + 1 >= m_KeyframeInterval ||
+                    state.size() != m_Newest.size();
+    if (keyframe)
+    {
+        data = state;
+        m_SinceKeyframe = 0;
+    }
+    else
+    {
+        data.resize(DeltaCodec::MaxEncodedSize(state.size()));
+        data.resize(DeltaCodec::Encode(m_Newest.data(), state.data(), state.size(), data.data()));
+        data.shrink_to_fit();
+        ++m_SinceKeyframe;
+    }
+
+    Entry &entry = m_Entries[m_Head];
+    entry.Data.swap(data);
+    entry.Keyframe = keyframe;
+    m_Newest = state;
+
+    m_Head = (m_Head + 1) % m_Entries.size();
+    if (!full)
+        ++m_Count;
+}
+
+bool PhysicsStateHistory::Get(size_t age, std::vector<uint8_t> &outState) const
+{
+    if (age >= m_Count)
+        return false;
+    if (age == 0)
+    {
+        outState = m_Newest;
+        return true;
+    }
+    return Reconstruct(age, outState);
+}
+
+bool PhysicsStateHistory::Reconstruct(size_t age, std::vector<uint8_t> &outState) const
+{
+    // Walk back to the keyframe the requested snapshot depends on, then apply deltas forward
+    size_t keyAge = age;
+    while (!m_Entries[Slot(keyAge)].Keyframe)
+    {
+        if (keyAge + 1 >= m_Count)
+            return false;
+        ++keyAge;
+    }
+
+    outState = m_Entries[Slot(keyAge)].Data;
+    for (size_t a = keyAge; a > age; --a)
+    {
+        const std::vector<uint8_t> &delta = m_Entries[Slot(a - 1)].Data;
+        if (!DeltaCodec::Apply(outState.data(), outState.size(), delta.data(), delta.size()))
+            return false;
+    }
+    return true;
+}
+
+void PhysicsStateHistory::DiscardNewest(size_t count)
+{
+    count = count < m_Count ? count : m_Count;
+    m_Head = (m_Head + m_Entries.size() - count) % m_Entries.size();
+    m_Count -= count;
+
+    m_Newest.clear();
+    m_SinceKeyframe = 0;
+    if (m_Count == 0)
+        return;
+
+    // The surviving newest snapshot becomes the base for the next delta
+    Reconstruct(0, m_Newest);
+    while (m_SinceKeyframe < m_Count && !m_Entries[Slot(m_SinceKeyframe)].Keyframe)
+        ++m_SinceKeyframe;
+}
+
+void PhysicsStateHistory::Clear()
+{
+    m_Head = 0;
+    m_Count = 0;
+    m_SinceKeyframe = 0;
+    m_Newest.clear();
+}
+
+size_t PhysicsStateHistory::GetMemoryUsage() const
+{
+    size_t bytes = m_Newest.capacity();
+    for (const Entry &entry : m_Entries)
+        bytes += entry.Data.capacity();
+    return bytes;
+}
+
+} // namespace TE
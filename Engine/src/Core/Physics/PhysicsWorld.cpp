@@ -1,13 +1,44 @@
 #include "Core/Physics/PhysicsWorld.hpp"
 #include "Core/Log.h"
+#include "Core/Threading/TaskSystem.hpp"
 #include "Layers/ProfilingLayer.hpp"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
 #include <velox/VeloxAPI.h>
 
 namespace TE
 {
 
+// Bulk transfers across the Velox boundary, fed from SoA arrays. Velox only exposes per-entity accessors, so
+// these are the single place that loops over them; bulk entry points can replace the loops without touching Step.
+static void SetVeloxVelocities(VeloxWorld *world, const uint32_t *ids, const float *vx, const float *vy,
+                               size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        Velox_SetVelocity(world, ids[i], vx[i], vy[i]);
+}
+
+static void GetVeloxTransforms(VeloxWorld *world, const uint32_t *ids, float *x, float *y, float *rotation,
+                               size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        Velox_GetPosition(world, ids[i], &x[i], &y[i], &rotation[i]);
+}
+
+static void GetVeloxSleepStates(VeloxWorld *world, const uint32_t *ids, uint8_t *sleeping, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        sleeping[i] = Velox_IsSleeping(world, ids[i]) ? 1 : 0;
+}
+
+static BoundsAABB GetBodyBounds(const RigidBody &body)
+{
+    BoundsAABB bounds = GetShapeBounds(body.Shape);
+    return {bounds.min + body.Position, bounds.max + body.Position};
+}
+
 PhysicsWorld::PhysicsWorld()
 {
     m_VeloxWorld = Velox_CreateWorld();
@@ -19,6 +50,12 @@ PhysicsWorld::PhysicsWorld()
 
 PhysicsWorld::~PhysicsWorld()
 {
+    for (RigidBody *body : m_Bodies)
+    {
+        body->m_World = nullptr;
+        body->m_WorldIndex = InvalidSlot;
+    }
+
     if (m_VeloxWorld)
     {
         Velox_DestroyWorld((VeloxWorld *)m_VeloxWorld);
@@ -28,24 +65,59 @@ PhysicsWorld::~PhysicsWorld()
 
 void PhysicsWorld::AddBody(RigidBody *body)
 {
+    if (body->m_World)
+        return;
+
+    uint32_t index = (uint32_t)m_Bodies.size();
+    body->PreviousPosition = body->Position;
+    body->Shape.UpdateVertexCache();
+    body->m_World = this;
+    body->m_WorldIndex = index;
+    body->IsSleeping = false; // Velox creates bodies awake
     m_Bodies.push_back(body);
+    m_VeloxIDs.push_back(0);
+    m_SyncedVelocityX.push_back(body->Velocity.x);
+    m_SyncedVelocityY.push_back(body->Velocity.y);
+    m_Sleeping.push_back(0);
+    m_Rotations.push_back(0.0f);
+    m_SimVelocityX.push_back(body->Velocity.x);
+    m_SimVelocityY.push_back(body->Velocity.y);
+    m_QueryProxies.push_back(m_QueryTree.CreateProxy(GetBodyBounds(*body), index));
+    m_AwakeSlot.push_back(InvalidSlot);
+    m_SettledSlot.push_back(InvalidSlot);
+    m_IslandParent.push_back(index);
+    m_IslandStamp.push_back(0);
+    m_IslandAwake.push_back(0);
+    m_JointGraphDirty = true;
+    if (!body->IsStatic)
+        AddAwake(index);
 
     if (!m_VeloxWorld)
         return;
 
+    CreateVeloxBody((uint32_t)m_Bodies.size() - 1, 0.0f, body->Velocity);
+    body->m_VeloxEntityID = RegisterEntity(m_VeloxIDs.back());
+    m_BodyByEntity.resize(m_NextEntityID, InvalidSlot);
+    m_BodyByEntity[body->m_VeloxEntityID] = index;
+}
+
+void PhysicsWorld::CreateVeloxBody(uint32_t index, float rotation, const TEVector2 &velocity)
+{
+    RigidBody *body = m_Bodies[index];
+
     // 1. Create Velox Entity
     uint32_t id = Velox_CreateEntity((VeloxWorld *)m_VeloxWorld);
-    body->m_VeloxEntityID = id;
+    m_VeloxIDs[index] = id;
 
     // 2. Add Transform Component
-    Velox_AddTransform((VeloxWorld *)m_VeloxWorld, id, body->Position.x, body->Position.y, 0.0f);
+    Velox_AddTransform((VeloxWorld *)m_VeloxWorld, id, body->Position.x, body->Position.y, rotation);
 
     // 3. Add RigidBody Component
     Velox_AddRigidBody((VeloxWorld *)m_VeloxWorld, id, body->Mass, body->IsStatic);
 
     // 4. Add Movement Component (stores velocity)
     Velox_AddMovement((VeloxWorld *)m_VeloxWorld, id);
-    Velox_SetVelocity((VeloxWorld *)m_VeloxWorld, id, body->Velocity.x, body->Velocity.y);
+    Velox_SetVelocity((VeloxWorld *)m_VeloxWorld, id, velocity.x, velocity.y);
 
     // 5. Add Physical Material Component
     Velox_AddPhysicalMaterial((VeloxWorld *)m_VeloxWorld, id, 0.5f, 0.3f, body->Restitution);
@@ -91,17 +163,91 @@ void PhysicsWorld::AddBody(RigidBody *body)
     }
 }
 
+uint32_t PhysicsWorld::RegisterEntity(uint32_t veloxID)
+{
+    uint32_t entityID = m_NextEntityID++;
+    m_EntityToVelox[entityID] = veloxID;
+    m_VeloxToEntity[veloxID] = entityID;
+    return entityID;
+}
+
+uint32_t PhysicsWorld::ToVelox(uint32_t entityID) const
+{
+    auto it = m_EntityToVelox.find(entityID);
+    return it != m_EntityToVelox.end() ? it->second : 0;
+}
+
+uint32_t PhysicsWorld::ToEntity(uint32_t veloxID) const
+{
+    auto it = m_VeloxToEntity.find(veloxID);
+    return it != m_VeloxToEntity.end() ? it->second : 0;
+}
+
 void PhysicsWorld::RemoveBody(RigidBody *body)
 {
-    auto it = std::find(m_Bodies.begin(), m_Bodies.end(), body);
-    if (it != m_Bodies.end())
+    if (body->m_World != this)
+        return;
+
+    // Swap-remove from the body list and every parallel array
+    uint32_t index = body->m_WorldIndex;
+    uint32_t last = (uint32_t)m_Bodies.size() - 1;
+    uint32_t veloxID = m_VeloxIDs[index];
+    RemoveAwake(index);
+    RemoveSettled(index);
+    m_JointGraphDirty = true;
+    if (m_QueryProxies[index] != DynamicAABBTree::NullNode)
+        m_QueryTree.DestroyProxy(m_QueryProxies[index]);
+    if (index != last)
     {
-        m_Bodies.erase(it);
+        m_QueryProxies[index] = m_QueryProxies[last];
+        m_Bodies[index] = m_Bodies[last];
+        m_VeloxIDs[index] = m_VeloxIDs[last];
+        m_SyncedVelocityX[index] = m_SyncedVelocityX[last];
+        m_SyncedVelocityY[index] = m_SyncedVelocityY[last];
+        m_Sleeping[index] = m_Sleeping[last];
+        m_Rotations[index] = m_Rotations[last];
+        m_SimVelocityX[index] = m_SimVelocityX[last];
+        m_SimVelocityY[index] = m_SimVelocityY[last];
+        m_AwakeSlot[index] = m_AwakeSlot[last];
+        m_SettledSlot[index] = m_SettledSlot[last];
+        m_IslandStamp[index] = 0;
+        if (m_AwakeSlot[index] != InvalidSlot)
+            m_AwakeBodies[m_AwakeSlot[index]] = index;
+        if (m_SettledSlot[index] != InvalidSlot)
+            m_SettledBodies[m_SettledSlot[index]] = index;
+        if (m_QueryProxies[index] != DynamicAABBTree::NullNode)
+            m_QueryTree.SetUserData(m_QueryProxies[index], index);
+        m_Bodies[index]->m_WorldIndex = index;
+        if (m_Bodies[index]->m_VeloxEntityID != 0)
+            m_BodyByEntity[m_Bodies[index]->m_VeloxEntityID] = index;
     }
+    m_Bodies.pop_back();
+    m_VeloxIDs.pop_back();
+    m_SyncedVelocityX.pop_back();
+    m_SyncedVelocityY.pop_back();
+    m_Sleeping.pop_back();
+    m_Rotations.pop_back();
+    m_SimVelocityX.pop_back();
+    m_SimVelocityY.pop_back();
+    m_QueryProxies.pop_back();
+    m_AwakeSlot.pop_back();
+    m_SettledSlot.pop_back();
+    m_IslandParent.pop_back();
+    m_IslandStamp.pop_back();
+    m_IslandAwake.pop_back();
+    body->m_World = nullptr;
+    body->m_WorldIndex = InvalidSlot;
 
-    if (m_VeloxWorld && body->m_VeloxEntityID != 0)
+    if (m_VeloxWorld && veloxID != 0)
     {
-        Velox_DestroyEntity((VeloxWorld *)m_VeloxWorld, body->m_VeloxEntityID);
+        Velox_DestroyEntity((VeloxWorld *)m_VeloxWorld, veloxID);
+        m_VeloxToEntity.erase(veloxID);
+    }
+    if (body->m_VeloxEntityID != 0)
+    {
+        m_BodyByEntity[body->m_VeloxEntityID] = InvalidSlot;
+        m_EntityToVelox.erase(body->m_VeloxEntityID);
+        m_ColliderSettings.erase(body->m_VeloxEntityID);
         body->m_VeloxEntityID = 0;
     }
 }
@@ -115,39 +261,112 @@ void PhysicsWorld::Step(float dt)
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // 1. Sync any manual position/velocity updates from client code to Velox
-    for (auto *body : m_Bodies)
+    VeloxWorld *world = (VeloxWorld *)m_VeloxWorld;
+
+    // 1. Apply accumulated forces and batch the velocities client code changed since the last sync. Only the
+    // awake set is visited; a sleeping body enters it again through WakeBody.
+    ClearSettled();
+    m_BatchIDs.clear();
+    m_BatchX.clear();
+    m_BatchY.clear();
+    for (uint32_t index : m_AwakeBodies)
     {
-        if (body->m_VeloxEntityID != 0)
+        RigidBody *body = m_Bodies[index];
+        if (m_VeloxIDs[index] == 0)
+            continue;
+
+        if (body->Force.x != 0.0f || body->Force.y != 0.0f)
         {
-            // Apply accumulated force if any
-            if (body->Force.x != 0.0f || body->Force.y != 0.0f)
+            if (body->Mass > 0.0f)
             {
-                if (!body->IsStatic && body->Mass > 0.0f)
-                {
-                    body->Velocity += (body->Force / body->Mass) * dt;
-                }
-                body->Force = {0.0f, 0.0f};
+                body->Velocity += (body->Force / body->Mass) * dt;
             }
-            // Sync current velocity to Velox in case client code modified it
-            Velox_SetVelocity((VeloxWorld *)m_VeloxWorld, body->m_VeloxEntityID, body->Velocity.x, body->Velocity.y);
+            body->Force = {0.0f, 0.0f};
+        }
+
+        if (body->Velocity.x != m_SyncedVelocityX[index] || body->Velocity.y != m_SyncedVelocityY[index])
+        {
+            m_SyncedVelocityX[index] = body->Velocity.x;
+            m_SyncedVelocityY[index] = body->Velocity.y;
+            m_Sleeping[index] = 0; // Setting a velocity wakes the body in Velox
+            m_BatchIDs.push_back(m_VeloxIDs[index]);
+            m_BatchX.push_back(body->Velocity.x);
+            m_BatchY.push_back(body->Velocity.y);
         }
     }
+    SetVeloxVelocities(world, m_BatchIDs.data(), m_BatchX.data(), m_BatchY.data(), m_BatchIDs.size());
 
     // 2. Step Velox Simulation
-    Velox_Step((VeloxWorld *)m_VeloxWorld, dt);
+    Velox_Step(world, dt);
+    ++m_Tick;
+
+    // 3. Read the awake set back first, so its islands are gathered around the bodies' post-step bounds
+    m_BatchBodies.clear();
+    m_BatchIDs.clear();
+    for (uint32_t index : m_AwakeBodies)
+    {
+        if (m_VeloxIDs[index] != 0)
+        {
+            m_BatchBodies.push_back(index);
+            m_BatchIDs.push_back(m_VeloxIDs[index]);
+        }
+    }
+    ReadBackBodies(dt);
 
-    // 3. Query simulated results back to RigidBody structures
-    for (auto *body : m_Bodies)
+    // 4. Refresh the sleep states of the awake islands: the awake set plus the sleeping bodies touching or
+    // joined to it, which the step may have woken
+    GatherIslands();
+    m_BatchIDs.resize(m_IslandBodies.size());
+    for (size_t i = 0; i < m_IslandBodies.size(); ++i)
+        m_BatchIDs[i] = m_VeloxIDs[m_IslandBodies[i]];
+    m_BatchSleeping.resize(m_BatchIDs.size());
+    GetVeloxSleepStates(world, m_BatchIDs.data(), m_BatchSleeping.data(), m_BatchIDs.size());
+
+    for (size_t i = 0; i < m_IslandBodies.size(); ++i)
     {
-        if (body->m_VeloxEntityID != 0)
+        if (!m_BatchSleeping[i])
+            m_IslandAwake[FindIsland(m_IslandBodies[i])] = 1;
+    }
+
+    // An island stays in the awake set while any of its bodies is awake. A sleeping neighbour that the step
+    // woke up was not read back above, so it is read back now.
+    m_BatchBodies.clear();
+    m_BatchIDs.clear();
+    m_AwakeIslandCount = 0;
+    for (size_t i = 0; i < m_IslandBodies.size(); ++i)
+    {
+        uint32_t index = m_IslandBodies[i];
+        uint32_t island = FindIsland(index);
+        RigidBody *body = m_Bodies[index];
+        bool wasAwakeSet = m_AwakeSlot[index] != InvalidSlot;
+        m_Sleeping[index] = m_BatchSleeping[i];
+        body->IsSleeping = m_BatchSleeping[i] != 0;
+        if (m_BatchSleeping[i])
+        {
+            m_SimVelocityX[index] = m_SimVelocityY[index] = 0.0f;
+            m_SyncedVelocityX[index] = m_SyncedVelocityY[index] = 0.0f;
+            body->Velocity = {0.0f, 0.0f};
+        }
+
+        if (m_IslandAwake[island])
+        {
+            AddAwake(index);
+            if (island == index)
+                ++m_AwakeIslandCount;
+        }
+        else if (wasAwakeSet)
         {
-            float x = 0.0f, y = 0.0f, rot = 0.0f;
-            Velox_GetPosition((VeloxWorld *)m_VeloxWorld, body->m_VeloxEntityID, &x, &y, &rot);
-            body->Position = {x, y};
-            body->IsSleeping = Velox_IsSleeping((VeloxWorld *)m_VeloxWorld, body->m_VeloxEntityID);
+            RemoveAwake(index);
+            AddSettled(index);
+        }
+
+        if (!wasAwakeSet && !m_BatchSleeping[i])
+        {
+            m_BatchBodies.push_back(index);
+            m_BatchIDs.push_back(m_VeloxIDs[index]);
         }
     }
+    ReadBackBodies(dt);
 
     auto endTime = std::chrono::high_resolution_clock::now();
     float durationMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
@@ -158,6 +377,230 @@ void PhysicsWorld::Step(float dt)
     }
 }
 
+void PhysicsWorld::ReadBackBodies(float dt)
+{
+    const size_t count = m_BatchBodies.size();
+    m_BatchX.resize(count);
+    m_BatchY.resize(count);
+    m_BatchRotation.resize(count);
+    GetVeloxTransforms((VeloxWorld *)m_VeloxWorld, m_BatchIDs.data(), m_BatchX.data(), m_BatchY.data(),
+                       m_BatchRotation.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        // The solver derives velocity from displacement, so this is the velocity Velox carries into the next step
+        uint32_t index = m_BatchBodies[i];
+        RigidBody *body = m_Bodies[index];
+        m_SimVelocityX[index] = (m_BatchX[i] - body->Position.x) / dt;
+        m_SimVelocityY[index] = (m_BatchY[i] - body->Position.y) / dt;
+
+        // Hand the solver's velocity back, so the next force or velocity edit applies on top of it instead of
+        // replacing it with the stale value the client last wrote
+        body->Velocity = {m_SimVelocityX[index], m_SimVelocityY[index]};
+        m_SyncedVelocityX[index] = body->Velocity.x;
+        m_SyncedVelocityY[index] = body->Velocity.y;
+        body->Position = {m_BatchX[i], m_BatchY[i]};
+        m_Rotations[index] = m_BatchRotation[i];
+        m_QueryTree.MoveProxy(m_QueryProxies[index], GetBodyBounds(*body));
+    }
+}
+
+// Index sets with a slot array for O(1) membership, insertion and swap-removal
+static void AddToSet(std::vector<uint32_t> &set, std::vector<uint32_t> &slots, uint32_t index, uint32_t invalid)
+{
+    if (slots[index] != invalid)
+        return;
+    slots[index] = (uint32_t)set.size();
+    set.push_back(index);
+}
+
+static void RemoveFromSet(std::vector<uint32_t> &set, std::vector<uint32_t> &slots, uint32_t index, uint32_t invalid)
+{
+    uint32_t slot = slots[index];
+    if (slot == invalid)
+        return;
+    uint32_t moved = set.back();
+    set[slot] = moved;
+    slots[moved] = slot;
+    set.pop_back();
+    slots[index] = invalid;
+}
+
+void PhysicsWorld::AddAwake(uint32_t index) { AddToSet(m_AwakeBodies, m_AwakeSlot, index, InvalidSlot); }
+
+void PhysicsWorld::RemoveAwake(uint32_t index) { RemoveFromSet(m_AwakeBodies, m_AwakeSlot, index, InvalidSlot); }
+
+void PhysicsWorld::AddSettled(uint32_t index) { AddToSet(m_SettledBodies, m_SettledSlot, index, InvalidSlot); }
+
+void PhysicsWorld::RemoveSettled(uint32_t index)
+{
+    RemoveFromSet(m_SettledBodies, m_SettledSlot, index, InvalidSlot);
+}
+
+void PhysicsWorld::ClearSettled()
+{
+    for (uint32_t index : m_SettledBodies)
+        m_SettledSlot[index] = InvalidSlot;
+    m_SettledBodies.clear();
+}
+
+void PhysicsWorld::WakeBody(RigidBody *body)
+{
+    if (body->m_World != this)
+        return;
+    uint32_t index = body->m_WorldIndex;
+
+    // Step only refreshes the query bounds of the bodies it moves; a body moved by hand is picked up here
+    m_QueryTree.MoveProxy(m_QueryProxies[index], GetBodyBounds(*body));
+    if (body->IsStatic)
+        return;
+    AddAwake(index);
+    m_Sleeping[index] = 0;
+    body->IsSleeping = false;
+}
+
+uint32_t PhysicsWorld::FindIsland(uint32_t index)
+{
+    while (m_IslandParent[index] != index)
+    {
+        m_IslandParent[index] = m_IslandParent[m_IslandParent[index]]; // Path halving
+        index = m_IslandParent[index];
+    }
+    return index;
+}
+
+void PhysicsWorld::BuildJointGraph()
+{
+    m_JointGraphDirty = false;
+
+    // Joints name their bodies by entity ID; soft-body nodes, removed and static bodies have no dynamic body
+    auto dynamicBody = [this](uint32_t entityID)
+    {
+        uint32_t index = entityID < m_BodyByEntity.size() ? m_BodyByEntity[entityID] : InvalidSlot;
+        return index != InvalidSlot && !m_Bodies[index]->IsStatic ? index : InvalidSlot;
+    };
+
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (const JointRecord &joint : m_Joints)
+    {
+        uint32_t a = dynamicBody(joint.EntityA);
+        uint32_t b = dynamicBody(joint.EntityB);
+        if (a != InvalidSlot && b != InvalidSlot && a != b)
+            edges.emplace_back(a, b);
+    }
+
+    m_JointOffsets.assign(m_Bodies.size() + 1, 0);
+    for (const auto &[a, b] : edges)
+    {
+        ++m_JointOffsets[a + 1];
+        ++m_JointOffsets[b + 1];
+    }
+    for (size_t i = 1; i < m_JointOffsets.size(); ++i)
+        m_JointOffsets[i] += m_JointOffsets[i - 1];
+
+    m_JointLinks.resize(edges.size() * 2);
+    std::vector<uint32_t> cursor(m_JointOffsets.begin(), m_JointOffsets.end() - 1);
+    for (const auto &[a, b] : edges)
+    {
+        m_JointLinks[cursor[a]++] = b;
+        m_JointLinks[cursor[b]++] = a;
+    }
+}
+
+void PhysicsWorld::GatherIslands()
+{
+    if (m_JointGraphDirty)
+        BuildJointGraph();
+
+    ++m_IslandStep;
+    m_IslandBodies.clear();
+    auto visit = [&](uint32_t index)
+    {
+        if (m_IslandStamp[index] == m_IslandStep)
+            return;
+        m_IslandStamp[index] = m_IslandStep;
+        m_IslandParent[index] = index;
+        m_IslandAwake[index] = 0;
+        m_IslandBodies.push_back(index);
+    };
+    auto link = [&](uint32_t index, uint32_t other)
+    {
+        visit(other);
+        uint32_t a = FindIsland(index), b = FindIsland(other);
+        if (a != b)
+            m_IslandParent[std::max(a, b)] = std::min(a, b);
+    };
+
+    for (uint32_t index : m_AwakeBodies)
+    {
+        if (m_VeloxIDs[index] != 0)
+            visit(index);
+    }
+
+    // Joints are followed from every member, since a joint moves its bodies together however far apart they are.
+    // Contacts are only expanded from the awake bodies: a sleeping neighbour that woke up brings in its own
+    // neighbours on the next step, once it is in the awake set. Indexing keeps the loop valid while visit appends.
+    const size_t awakeCount = m_IslandBodies.size();
+    for (size_t i = 0; i < m_IslandBodies.size(); ++i)
+    {
+        uint32_t index = m_IslandBodies[i];
+        for (uint32_t j = m_JointOffsets[index]; j < m_JointOffsets[index + 1]; ++j)
+        {
+            if (m_VeloxIDs[m_JointLinks[j]] != 0)
+                link(index, m_JointLinks[j]);
+        }
+        if (i >= awakeCount)
+            continue;
+
+        // Read back before this runs, so the fat bounds already contain the post-step positions
+        m_QueryTree.Query(m_QueryTree.GetFatAABB(m_QueryProxies[index]),
+                          [&](int32_t proxy)
+                          {
+                              uint32_t other = m_QueryTree.GetUserData(proxy);
+                              if (other == index || m_Bodies[other]->IsStatic || m_VeloxIDs[other] == 0)
+                                  return true;
+                              link(index, other);
+                              return true;
+                          });
+    }
+}
+
+int PhysicsWorld::Advance(float frameDeltaTime)
+{
+    if (frameDeltaTime > 0.0f)
+        m_Accumulator += frameDeltaTime;
+
+    int steps = 0;
+    while (m_Accumulator >= m_FixedDeltaTime && steps < m_MaxSubSteps)
+    {
+        // Sleeping bodies do not move, so only the awake set and the bodies that just settled need this
+        for (uint32_t index : m_AwakeBodies)
+            m_Bodies[index]->PreviousPosition = m_Bodies[index]->Position;
+        for (uint32_t index : m_SettledBodies)
+            m_Bodies[index]->PreviousPosition = m_Bodies[index]->Position;
+
+        Step(m_FixedDeltaTime);
+        m_Accumulator -= m_FixedDeltaTime;
+        ++steps;
+    }
+
+    // Over budget: keep only the sub-step remainder so interpolation stays continuous
+    if (m_Accumulator >= m_FixedDeltaTime)
+        m_Accumulator = std::fmod(m_Accumulator, m_FixedDeltaTime);
+
+    return steps;
+}
+
+void PhysicsWorld::SetTickRate(float ticksPerSecond)
+{
+    if (ticksPerSecond <= 0.0f)
+        return;
+
+    // Keep the same fraction of a step pending so a rate change does not pop
+    float alpha = GetInterpolationAlpha();
+    m_FixedDeltaTime = 1.0f / ticksPerSecond;
+    m_Accumulator = alpha * m_FixedDeltaTime;
+}
+
 void PhysicsWorld::ResolveCollisions()
 {
     // Resolving is fully handled inside Velox_Step via XPBD solver now
@@ -175,23 +618,25 @@ void PhysicsWorld::SetGravity(const TEVector2 &gravity)
 void PhysicsWorld::AddDistanceJoint(uint32_t entityA, uint32_t entityB, const TEVector2 &anchorA,
                                     const TEVector2 &anchorB, float targetDistance, float compliance)
 {
+    JointRecord joint{JointType::Distance, entityA, entityB,
+                      {anchorA.x, anchorA.y, anchorB.x, anchorB.y, targetDistance, compliance}};
+    m_Joints.push_back(joint);
     if (m_VeloxWorld)
-    {
-        Velox_AddDistanceJoint((VeloxWorld *)m_VeloxWorld, entityA, entityB, anchorA.x, anchorA.y, anchorB.x, anchorB.y,
-                               targetDistance, compliance);
-    }
+        CreateVeloxJoint(joint);
 }
 
 void PhysicsWorld::AddRevoluteJoint(uint32_t entityA, uint32_t entityB, const TEVector2 &anchorA,
                                     const TEVector2 &anchorB, float compliance, bool limitsEnabled, float lowerAngle,
                                     float upperAngle, bool enableMotor, float motorSpeed, float maxMotorTorque)
 {
+    JointRecord joint{JointType::Revolute,
+                      entityA,
+                      entityB,
+                      {anchorA.x, anchorA.y, anchorB.x, anchorB.y, compliance, limitsEnabled ? 1.0f : 0.0f, lowerAngle,
+                       upperAngle, enableMotor ? 1.0f : 0.0f, motorSpeed, maxMotorTorque}};
+    m_Joints.push_back(joint);
     if (m_VeloxWorld)
-    {
-        Velox_AddRevoluteJoint((VeloxWorld *)m_VeloxWorld, entityA, entityB, anchorA.x, anchorA.y, anchorB.x, anchorB.y,
-                               compliance, limitsEnabled, lowerAngle, upperAngle, enableMotor, motorSpeed,
-                               maxMotorTorque);
-    }
+        CreateVeloxJoint(joint);
 }
 
 void PhysicsWorld::AddPrismaticJoint(uint32_t entityA, uint32_t entityB, const TEVector2 &anchorA,
@@ -199,76 +644,181 @@ void PhysicsWorld::AddPrismaticJoint(uint32_t entityA, uint32_t entityB, const T
                                      bool limitsEnabled, float minTranslation, float maxTranslation, bool enableMotor,
                                      float motorSpeed, float maxMotorForce)
 {
+    JointRecord joint{JointType::Prismatic,
+                      entityA,
+                      entityB,
+                      {anchorA.x, anchorA.y, anchorB.x, anchorB.y, axisA.x, axisA.y, compliance,
+                       limitsEnabled ? 1.0f : 0.0f, minTranslation, maxTranslation, enableMotor ? 1.0f : 0.0f,
+                       motorSpeed, maxMotorForce}};
+    m_Joints.push_back(joint);
     if (m_VeloxWorld)
-    {
-        Velox_AddPrismaticJoint((VeloxWorld *)m_VeloxWorld, entityA, entityB, anchorA.x, anchorA.y, anchorB.x,
-                                anchorB.y, axisA.x, axisA.y, compliance, limitsEnabled, minTranslation, maxTranslation,
-                                enableMotor, motorSpeed, maxMotorForce);
-    }
+        CreateVeloxJoint(joint);
 }
 
 void PhysicsWorld::AddGearJoint(uint32_t entityA, uint32_t entityB, float gearRatio, float compliance)
 {
+    JointRecord joint{JointType::Gear, entityA, entityB, {gearRatio, compliance}};
+    m_Joints.push_back(joint);
     if (m_VeloxWorld)
-    {
-        Velox_AddGearJoint((VeloxWorld *)m_VeloxWorld, entityA, entityB, gearRatio, compliance);
-    }
+        CreateVeloxJoint(joint);
 }
 
 void PhysicsWorld::AddPulleyJoint(uint32_t entityA, uint32_t entityB, const TEVector2 &groundA,
                                   const TEVector2 &groundB, const TEVector2 &anchorA, const TEVector2 &anchorB,
                                   float ratio, float totalLength, float compliance)
 {
+    JointRecord joint{JointType::Pulley,
+                      entityA,
+                      entityB,
+                      {groundA.x, groundA.y, groundB.x, groundB.y, anchorA.x, anchorA.y, anchorB.x, anchorB.y, ratio,
+                       totalLength, compliance}};
+    m_Joints.push_back(joint);
     if (m_VeloxWorld)
+        CreateVeloxJoint(joint);
+}
+
+void PhysicsWorld::CreateVeloxJoint(const JointRecord &joint)
+{
+    m_JointGraphDirty = true;
+    VeloxWorld *world = (VeloxWorld *)m_VeloxWorld;
+    uint32_t a = ToVelox(joint.EntityA);
+    uint32_t b = ToVelox(joint.EntityB);
+    const float *p = joint.Params;
+    switch (joint.Type)
     {
-        Velox_AddPulleyJoint((VeloxWorld *)m_VeloxWorld, entityA, entityB, groundA.x, groundA.y, groundB.x, groundB.y,
-                             anchorA.x, anchorA.y, anchorB.x, anchorB.y, ratio, totalLength, compliance);
+    case JointType::Distance:
+        Velox_AddDistanceJoint(world, a, b, p[0], p[1], p[2], p[3], p[4], p[5]);
+        break;
+    case JointType::Revolute:
+        Velox_AddRevoluteJoint(world, a, b, p[0], p[1], p[2], p[3], p[4], p[5] != 0.0f, p[6], p[7], p[8] != 0.0f,
+                               p[9], p[10]);
+        break;
+    case JointType::Prismatic:
+        Velox_AddPrismaticJoint(world, a, b, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7] != 0.0f, p[8], p[9],
+                                p[10] != 0.0f, p[11], p[12]);
+        break;
+    case JointType::Gear:
+        Velox_AddGearJoint(world, a, b, p[0], p[1]);
+        break;
+    case JointType::Pulley:
+        Velox_AddPulleyJoint(world, a, b, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9], p[10]);
+        break;
     }
 }
 
 void PhysicsWorld::SetColliderSensor(uint32_t entityID, bool isSensor)
 {
+    ColliderSettings &settings = m_ColliderSettings[entityID];
+    settings.HasSensor = true;
+    settings.IsSensor = isSensor;
     if (m_VeloxWorld)
     {
-        Velox_SetColliderSensor((VeloxWorld *)m_VeloxWorld, entityID, isSensor);
+        Velox_SetColliderSensor((VeloxWorld *)m_VeloxWorld, ToVelox(entityID), isSensor);
     }
 }
 
 void PhysicsWorld::SetColliderGroupId(uint32_t entityID, int groupId)
 {
+    ColliderSettings &settings = m_ColliderSettings[entityID];
+    settings.HasGroup = true;
+    settings.GroupId = groupId;
     if (m_VeloxWorld)
     {
-        Velox_SetColliderGroupId((VeloxWorld *)m_VeloxWorld, entityID, groupId);
+        Velox_SetColliderGroupId((VeloxWorld *)m_VeloxWorld, ToVelox(entityID), groupId);
     }
 }
 
+void PhysicsWorld::ApplyColliderSettings(uint32_t entityID, const ColliderSettings &settings)
+{
+    if (settings.HasSensor)
+        Velox_SetColliderSensor((VeloxWorld *)m_VeloxWorld, ToVelox(entityID), settings.IsSensor);
+    if (settings.HasGroup)
+        Velox_SetColliderGroupId((VeloxWorld *)m_VeloxWorld, ToVelox(entityID), settings.GroupId);
+}
+
 uint32_t PhysicsWorld::CreateSoftBodyBlob(const TEVector2 &center, float radius, int nodeCount, float compliance,
                                           float jointCompliance, float nodeRadius)
 {
-    if (m_VeloxWorld)
-    {
-        return Velox_CreateSoftBodyBlob((VeloxWorld *)m_VeloxWorld, center.x, center.y, radius, nodeCount, compliance,
-                                        jointCompliance, nodeRadius);
-    }
-    return 0;
+    if (!m_VeloxWorld)
+        return 0;
+
+    SoftBodyRecord record{};
+    record.ShapeMatched = false;
+    record.Center = center;
+    record.Radius = radius;
+    record.NodeCount = nodeCount;
+    record.Compliance = compliance;
+    record.JointCompliance = jointCompliance;
+    record.NodeRadius = nodeRadius;
+    CreateVeloxSoftBody(record);
+    if (record.EntityID != 0)
+        m_SoftBodies.push_back(record);
+    return record.EntityID;
 }
 
 uint32_t PhysicsWorld::CreateSoftBodyShapeMatched(const TEVector2 &center, float *verticesX, float *verticesY,
                                                   int vertexCount, float stiffness, float nodeRadius)
 {
-    if (m_VeloxWorld)
+    if (!m_VeloxWorld)
+        return 0;
+
+    SoftBodyRecord record{};
+    record.ShapeMatched = true;
+    record.Center = center;
+    record.VerticesX.assign(verticesX, verticesX + vertexCount);
+    record.VerticesY.assign(verticesY, verticesY + vertexCount);
+    record.Stiffness = stiffness;
+    record.NodeRadius = nodeRadius;
+    CreateVeloxSoftBody(record);
+    if (record.EntityID != 0)
+        m_SoftBodies.push_back(record);
+    return record.EntityID;
+}
+
+void PhysicsWorld::CreateVeloxSoftBody(SoftBodyRecord &record)
+{
+    VeloxWorld *world = (VeloxWorld *)m_VeloxWorld;
+    uint32_t id = 0;
+    if (record.ShapeMatched)
     {
-        return Velox_CreateSoftBodyShapeMatched((VeloxWorld *)m_VeloxWorld, center.x, center.y, verticesX, verticesY,
-                                                vertexCount, stiffness, nodeRadius);
+        id = Velox_CreateSoftBodyShapeMatched(world, record.Center.x, record.Center.y, record.VerticesX.data(),
+                                              record.VerticesY.data(), (int)record.VerticesX.size(), record.Stiffness,
+                                              record.NodeRadius);
+    }
+    else
+    {
+        id = Velox_CreateSoftBodyBlob(world, record.Center.x, record.Center.y, record.Radius, record.NodeCount,
+                                      record.Compliance, record.JointCompliance, record.NodeRadius);
+    }
+    if (id == 0)
+        return;
+
+    // First creation hands out new IDs; a rebuild maps the existing ones onto the new Velox entities
+    bool rebuilding = record.EntityID != 0;
+    int nodeCount = Velox_GetSoftBodyNodeCount(world, id);
+    if (!rebuilding)
+    {
+        record.EntityID = RegisterEntity(id);
+        for (int i = 0; i < nodeCount; ++i)
+            record.NodeIDs.push_back(RegisterEntity(Velox_GetSoftBodyNode(world, id, i)));
+        return;
+    }
+
+    m_EntityToVelox[record.EntityID] = id;
+    m_VeloxToEntity[id] = record.EntityID;
+    for (int i = 0; i < nodeCount && i < (int)record.NodeIDs.size(); ++i)
+    {
+        uint32_t node = Velox_GetSoftBodyNode(world, id, i);
+        m_EntityToVelox[record.NodeIDs[i]] = node;
+        m_VeloxToEntity[node] = record.NodeIDs[i];
     }
-    return 0;
 }
 
 int PhysicsWorld::GetSoftBodyNodeCount(uint32_t softBodyEntityID)
 {
     if (m_VeloxWorld)
     {
-        return Velox_GetSoftBodyNodeCount((VeloxWorld *)m_VeloxWorld, softBodyEntityID);
+        return Velox_GetSoftBodyNodeCount((VeloxWorld *)m_VeloxWorld, ToVelox(softBodyEntityID));
     }
     return 0;
 }
@@ -277,7 +827,7 @@ uint32_t PhysicsWorld::GetSoftBodyNode(uint32_t softBodyEntityID, int nodeIndex)
 {
     if (m_VeloxWorld)
     {
-        return Velox_GetSoftBodyNode((VeloxWorld *)m_VeloxWorld, softBodyEntityID, nodeIndex);
+        return ToEntity(Velox_GetSoftBodyNode((VeloxWorld *)m_VeloxWorld, ToVelox(softBodyEntityID), nodeIndex));
     }
     return 0;
 }
@@ -287,10 +837,401 @@ bool PhysicsWorld::Raycast(const TEVector2 &start, const TEVector2 &direction, f
 {
     if (m_VeloxWorld)
     {
-        return Velox_Raycast((VeloxWorld *)m_VeloxWorld, start.x, start.y, direction.x, direction.y, maxDistance,
-                             &hitPoint.x, &hitPoint.y, &hitNormal.x, &hitNormal.y, &fraction, &hitEntityID);
+        uint32_t veloxID = 0;
+        bool hit = Velox_Raycast((VeloxWorld *)m_VeloxWorld, start.x, start.y, direction.x, direction.y, maxDistance,
+                                 &hitPoint.x, &hitPoint.y, &hitNormal.x, &hitNormal.y, &fraction, &veloxID);
+        hitEntityID = ToEntity(veloxID);
+        return hit;
     }
     return false;
 }
 
+// ===== Snapshots =====
+
+static const uint32_t s_StateMagic = 0x53504554; // "TEPS" in little-endian byte order
+static const uint32_t s_StateVersion = 1;
+
+template <typename T> static void WriteValue(std::vector<uint8_t> &out, const T &value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T> static bool ReadValue(const std::vector<uint8_t> &in, size_t &offset, T &value)
+{
+    if (offset + sizeof(T) > in.size())
+        return false;
+    std::memcpy(&value, in.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+bool PhysicsWorld::CaptureState(std::vector<uint8_t> &outState) const
+{
+    outState.clear();
+    if (!m_SoftBodies.empty())
+    {
+        TE_CORE_ERROR("PhysicsWorld::CaptureState: soft bodies cannot be captured");
+        return false;
+    }
+
+    outState.reserve(32 + m_Bodies.size() * 57);
+
+    WriteValue(outState, s_StateMagic);
+    WriteValue(outState, s_StateVersion);
+    WriteValue(outState, m_Tick);
+    WriteValue(outState, m_Accumulator);
+    WriteValue(outState, m_Gravity.x);
+    WriteValue(outState, m_Gravity.y);
+    WriteValue(outState, (uint32_t)m_Bodies.size());
+
+    for (size_t i = 0; i < m_Bodies.size(); ++i)
+    {
+        const RigidBody *body = m_Bodies[i];
+        WriteValue(outState, body->m_VeloxEntityID);
+        WriteValue(outState, body->Position.x);
+        WriteValue(outState, body->Position.y);
+        WriteValue(outState, body->PreviousPosition.x);
+        WriteValue(outState, body->PreviousPosition.y);
+        WriteValue(outState, body->Velocity.x);
+        WriteValue(outState, body->Velocity.y);
+        WriteValue(outState, m_SyncedVelocityX[i]);
+        WriteValue(outState, m_SyncedVelocityY[i]);
+        WriteValue(outState, m_SimVelocityX[i]);
+        WriteValue(outState, m_SimVelocityY[i]);
+        WriteValue(outState, body->Force.x);
+        WriteValue(outState, body->Force.y);
+        WriteValue(outState, m_Rotations[i]);
+        WriteValue(outState, m_Sleeping[i]);
+    }
+    return true;
+}
+
+bool PhysicsWorld::RestoreState(const std::vector<uint8_t> &state)
+{
+    // Rebuilding the world would put every soft body back at its creation pose
+    if (!m_SoftBodies.empty())
+    {
+        TE_CORE_ERROR("PhysicsWorld::RestoreState: soft bodies cannot be restored");
+        return false;
+    }
+
+    size_t offset = 0;
+    uint32_t magic = 0, version = 0, bodyCount = 0;
+    uint64_t tick = 0;
+    float accumulator = 0.0f;
+    TEVector2 gravity;
+    if (!ReadValue(state, offset, magic) || magic != s_StateMagic || !ReadValue(state, offset, version) ||
+        version != s_StateVersion || !ReadValue(state, offset, tick) || !ReadValue(state, offset, accumulator) ||
+        !ReadValue(state, offset, gravity.x) || !ReadValue(state, offset, gravity.y) ||
+        !ReadValue(state, offset, bodyCount) || bodyCount != m_Bodies.size())
+    {
+        TE_CORE_ERROR("PhysicsWorld::RestoreState: snapshot does not match this world");
+        return false;
+    }
+
+    // Parse everything before touching the world so a bad snapshot leaves it untouched. Bodies are written field
+    // by field, so the blob has no padding.
+    m_RestoreBodies.resize(bodyCount);
+    for (BodyState &b : m_RestoreBodies)
+    {
+        bool ok = ReadValue(state, offset, b.EntityID) && ReadValue(state, offset, b.Position.x) &&
+                  ReadValue(state, offset, b.Position.y) && ReadValue(state, offset, b.PreviousPosition.x) &&
+                  ReadValue(state, offset, b.PreviousPosition.y) && ReadValue(state, offset, b.Velocity.x) &&
+                  ReadValue(state, offset, b.Velocity.y) && ReadValue(state, offset, b.SyncedVelocity.x) &&
+                  ReadValue(state, offset, b.SyncedVelocity.y) && ReadValue(state, offset, b.SimVelocity.x) &&
+                  ReadValue(state, offset, b.SimVelocity.y) && ReadValue(state, offset, b.Force.x) &&
+                  ReadValue(state, offset, b.Force.y) && ReadValue(state, offset, b.Rotation) &&
+                  ReadValue(state, offset, b.Sleeping);
+        if (!ok)
+        {
+            TE_CORE_ERROR("PhysicsWorld::RestoreState: truncated snapshot");
+            return false;
+        }
+    }
+
+    // Bodies may have been swap-removed and re-added in a different order since the capture
+    m_RestoreTargets.resize(bodyCount);
+    for (uint32_t i = 0; i < bodyCount; ++i)
+    {
+        uint32_t entityID = m_RestoreBodies[i].EntityID;
+        uint32_t index = entityID < m_BodyByEntity.size() ? m_BodyByEntity[entityID] : InvalidSlot;
+        if (index == InvalidSlot)
+        {
+            TE_CORE_ERROR("PhysicsWorld::RestoreState: snapshot does not match this world");
+            return false;
+        }
+        m_RestoreTargets[i] = index;
+    }
+
+    m_Tick = tick;
+    m_Accumulator = accumulator;
+    m_Gravity = gravity;
+    for (uint32_t i = 0; i < bodyCount; ++i)
+    {
+        const BodyState &b = m_RestoreBodies[i];
+        uint32_t index = m_RestoreTargets[i];
+        RigidBody *body = m_Bodies[index];
+        body->Position = b.Position;
+        body->PreviousPosition = b.PreviousPosition;
+        body->Velocity = b.Velocity;
+        body->Force = b.Force;
+        body->IsSleeping = b.Sleeping != 0;
+        m_SyncedVelocityX[index] = b.SyncedVelocity.x;
+        m_SyncedVelocityY[index] = b.SyncedVelocity.y;
+        m_SimVelocityX[index] = b.SimVelocity.x;
+        m_SimVelocityY[index] = b.SimVelocity.y;
+        m_Rotations[index] = b.Rotation;
+        m_Sleeping[index] = b.Sleeping;
+        m_QueryTree.MoveProxy(m_QueryProxies[index], GetBodyBounds(*body));
+    }
+
+    RebuildVeloxWorld();
+
+    // The rebuilt Velox world starts every body awake; Step drops them from the awake set as they settle
+    ClearSettled();
+    for (uint32_t i = 0; i < m_Bodies.size(); ++i)
+    {
+        if (!m_Bodies[i]->IsStatic)
+            AddAwake(i);
+    }
+    return true;
+}
+
+// Index of the first byte where two snapshots differ
+static size_t FirstDifference(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b)
+{
+    size_t offset = 0;
+    while (offset < a.size() && offset < b.size() && a[offset] == b[offset])
+        ++offset;
+    return offset;
+}
+
+bool PhysicsWorld::VerifyRestore(int steps, bool matchLive)
+{
+    std::vector<uint8_t> start, live, first, second;
+    if (!CaptureState(start))
+        return false;
+
+    for (int i = 0; i < steps; ++i)
+        Step(m_FixedDeltaTime);
+    CaptureState(live);
+
+    for (std::vector<uint8_t> *result : {&first, &second})
+    {
+        if (!RestoreState(start))
+            return false;
+        for (int i = 0; i < steps; ++i)
+            Step(m_FixedDeltaTime);
+        CaptureState(*result);
+    }
+    RestoreState(start);
+
+    if (first != second)
+    {
+        TE_CORE_ERROR("PhysicsWorld::VerifyRestore: restored runs diverged after {0} steps, at byte {1} of {2}", steps,
+                      FirstDifference(first, second), first.size());
+        return false;
+    }
+    if (first != live)
+    {
+        // Expected when the live world had warm-started contacts at the capture, see the contract in the header
+        TE_CORE_WARN("PhysicsWorld::VerifyRestore: restored run left the live one after {0} steps, at byte {1} of {2}",
+                     steps, FirstDifference(first, live), live.size());
+        return !matchLive;
+    }
+    return true;
+}
+
+void PhysicsWorld::RebuildVeloxWorld()
+{
+    if (m_VeloxWorld)
+        Velox_DestroyWorld((VeloxWorld *)m_VeloxWorld);
+    m_VeloxWorld = Velox_CreateWorld();
+    if (!m_VeloxWorld)
+        return;
+    Velox_SetGravity((VeloxWorld *)m_VeloxWorld, m_Gravity.x, m_Gravity.y);
+
+    // Recreate in a fixed order so repeated restores of one snapshot build identical worlds
+    m_EntityToVelox.clear();
+    m_VeloxToEntity.clear();
+    for (uint32_t i = 0; i < m_Bodies.size(); ++i)
+    {
+        CreateVeloxBody(i, m_Rotations[i], {m_SimVelocityX[i], m_SimVelocityY[i]});
+        m_EntityToVelox[m_Bodies[i]->m_VeloxEntityID] = m_VeloxIDs[i];
+        m_VeloxToEntity[m_VeloxIDs[i]] = m_Bodies[i]->m_VeloxEntityID;
+    }
+    for (SoftBodyRecord &record : m_SoftBodies)
+        CreateVeloxSoftBody(record);
+    for (const JointRecord &joint : m_Joints)
+        CreateVeloxJoint(joint);
+
+    std::vector<uint32_t> settingsOrder;
+    for (const auto &entry : m_ColliderSettings)
+        settingsOrder.push_back(entry.first);
+    std::sort(settingsOrder.begin(), settingsOrder.end());
+    for (uint32_t entityID : settingsOrder)
+        ApplyColliderSettings(entityID, m_ColliderSettings[entityID]);
+}
+
+// ===== Scene queries =====
+// Bodies carry their shape in local space around Position, so queries move into each body's frame instead of
+// building world-space copies of the shapes.
+
+// Earliest contact of a circle of the given radius (0 for a ray) swept from origin along direction
+static bool CastAgainstShape(const CollisionShape &shape, const TEVector2 &origin, const TEVector2 &direction,
+                             float maxDistance, float radius, float &outDistance, TEVector2 &outNormal)
+{
+    auto castCircle = [&](const TEVector2 &center, float circleRadius, float &t)
+    {
+        TEVector2 m = origin - center;
+        float b = Dot(m, direction);
+        float c = Dot(m, m) - circleRadius * circleRadius;
+        if (c > 0.0f && b > 0.0f)
+            return false;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f)
+            return false;
+        t = -b - std::sqrt(discriminant);
+        return t >= 0.0f && t <= maxDistance; // Starting inside reports no hit, matching the face test below
+    };
+
+    if (shape.type == CollisionType::Circle)
+    {
+        float t;
+        if (!castCircle(shape.circle.center, shape.circle.radius + radius, t))
+            return false;
+        outDistance = t;
+        outNormal = (origin + direction * t - shape.circle.center).Normalized();
+        return true;
+    }
+
+    const std::vector<TEVector2> &verts = shape.vertices;
+    const std::vector<TEVector2> &normals = shape.normals;
+    bool hit = false;
+    float best = maxDistance;
+    for (size_t i = 0; i < verts.size(); ++i)
+    {
+        // Faces pushed out by the radius; only ones the segment approaches from outside count
+        const TEVector2 &normal = normals[i];
+        float denom = Dot(normal, direction);
+        if (denom < 0.0f)
+        {
+            TEVector2 a = verts[i] + normal * radius;
+            TEVector2 b = verts[(i + 1) % verts.size()] + normal * radius;
+            float t = Dot(normal, a - origin) / denom;
+            if (t >= 0.0f && t <= best)
+            {
+                TEVector2 edge = b - a;
+                float u = Dot(origin + direction * t - a, edge);
+                if (u >= 0.0f && u <= Dot(edge, edge))
+                {
+                    best = t;
+                    outNormal = normal;
+                    hit = true;
+                }
+            }
+        }
+
+        // Rounded corners of the swept circle
+        float t;
+        if (radius > 0.0f && castCircle(verts[i], radius, t) && t <= best)
+        {
+            best = t;
+            outNormal = (origin + direction * t - verts[i]).Normalized();
+            hit = true;
+        }
+    }
+
+    outDistance = best;
+    return hit;
+}
+
+static bool CircleOverlapsShape(const CollisionShape &shape, const TEVector2 &center, float radius)
+{
+    if (shape.type == CollisionType::Circle)
+        return DistanceSquared(center, shape.circle.center) <= (shape.circle.radius + radius) *
+                                                                   (shape.circle.radius + radius);
+
+    const std::vector<TEVector2> &verts = shape.vertices;
+    if (verts.empty())
+        return false;
+
+    bool inside = true;
+    float minDistSq = FLT_MAX;
+    for (size_t i = 0; i < verts.size(); ++i)
+    {
+        const TEVector2 &a = verts[i];
+        TEVector2 edge = verts[(i + 1) % verts.size()] - a;
+        if (Dot(shape.normals[i], center - a) > 0.0f)
+            inside = false;
+
+        float lengthSq = Dot(edge, edge);
+        float t = lengthSq > 0.0f ? std::max(0.0f, std::min(1.0f, Dot(center - a, edge) / lengthSq)) : 0.0f;
+        minDistSq = std::min(minDistSq, DistanceSquared(center, a + edge * t));
+    }
+    return inside || minDistSq <= radius * radius;
+}
+
+void PhysicsWorld::RaycastBatch(const RaycastQuery *queries, RaycastHit *hits, size_t count, size_t parallelism)
+{
+    if (count == 0)
+        return;
+
+    // The tree is read-only from here on; every chunk reuses its own traversal stack, so a batch allocates
+    // nothing once the stacks have grown to the tree's depth
+    size_t maxChunks = parallelism == 0 ? TaskSystem::GetThreadCount(TaskType::CALC) + 1 : parallelism;
+    if (m_RayStacks.size() < maxChunks)
+        m_RayStacks.resize(maxChunks);
+
+    auto castRange = [&](size_t begin, size_t end, size_t chunk)
+    {
+        std::vector<int32_t> &stack = m_RayStacks[chunk];
+        for (size_t q = begin; q < end; ++q)
+        {
+            const RaycastQuery &query = queries[q];
+            RaycastHit &hit = hits[q];
+            hit = RaycastHit();
+
+            m_QueryTree.RayCast(query.Origin, query.Direction, query.MaxDistance, query.Radius, stack,
+                                [&](int32_t proxy, float maxDistance)
+                                {
+                                    const RigidBody &body = *m_Bodies[m_QueryTree.GetUserData(proxy)];
+                                    float distance;
+                                    TEVector2 normal;
+                                    if (!CastAgainstShape(body.Shape, query.Origin - body.Position, query.Direction,
+                                                          maxDistance, query.Radius, distance, normal))
+                                        return maxDistance;
+
+                                    hit.Hit = true;
+                                    hit.Normal = normal;
+                                    hit.Point = query.Origin + query.Direction * distance - normal * query.Radius;
+                                    hit.Fraction = query.MaxDistance > 0.0f ? distance / query.MaxDistance : 0.0f;
+                                    hit.EntityID = body.m_VeloxEntityID;
+                                    return distance;
+                                });
+        }
+    };
+
+    if (parallelism == 1)
+        castRange(0, count, 0);
+    else
+        TaskSystem::ParallelFor(TaskType::CALC, count, maxChunks, 64, castRange);
+}
+
+size_t PhysicsWorld::OverlapCircle(const TEVector2 &center, float radius, std::vector<uint32_t> &outEntityIDs)
+{
+    size_t before = outEntityIDs.size();
+    BoundsAABB bounds({center.x - radius, center.y - radius}, {center.x + radius, center.y + radius});
+    m_QueryTree.Query(bounds,
+                      [&](int32_t proxy)
+                      {
+                          const RigidBody &body = *m_Bodies[m_QueryTree.GetUserData(proxy)];
+                          if (CircleOverlapsShape(body.Shape, center - body.Position, radius))
+                              outEntityIDs.push_back(body.m_VeloxEntityID);
+                          return true;
+                      });
+    return outEntityIDs.size() - before;
+}
+
 } // namespace TE
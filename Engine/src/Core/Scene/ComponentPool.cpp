@@ -0,0 +1,91 @@
+#include "Core/Scene/ComponentPool.hpp"
+#include "GameFrameWork/TComponent.hpp"
+#include <algorithm>
+
+namespace TE
+{
+
+void ComponentPool::SetDense(EntityID entity, uint32_t index)
+{
+    uint32_t slot = GetEntitySlot(entity);
+    size_t page = slot >> PageBits;
+    if (page >= m_Sparse.size())
+        m_Sparse.resize(page + 1);
+    if (!m_Sparse[page])
+    {
+        m_Sparse[page].reset(new uint32_t[PageSize]);
+        std::fill(m_Sparse[page].get(), m_Sparse[page].get() + PageSize, InvalidIndex);
+    }
+    m_Sparse[page][slot & (PageSize - 1)] = index;
+}
+
+TComponent *ComponentPool::Add(EntityID entity, std::unique_ptr<TComponent> component)
+{
+    TComponent *ptr = component.get();
+    uint32_t index = FindDense(entity);
+    if (index != InvalidIndex)
+    {
+        m_Instances[index].push_back(std::move(component));
+        return ptr;
+    }
+
+    SetDense(entity, (uint32_t)m_Entities.size());
+    m_Entities.push_back(entity);
+    m_Primary.push_back(ptr);
+    m_Instances.emplace_back();
+    m_Instances.back().push_back(std::move(component));
+    return ptr;
+}
+
+void ComponentPool::EraseDense(uint32_t index)
+{
+    // Swap-remove keeps the dense arrays packed; the moved entity's sparse slot is patched
+    EntityID entity = m_Entities[index];
+    uint32_t last = (uint32_t)m_Entities.size() - 1;
+    if (index != last)
+    {
+        m_Entities[index] = m_Entities[last];
+        m_Primary[index] = m_Primary[last];
+        m_Instances[index] = std::move(m_Instances[last]);
+        SetDense(m_Entities[index], index);
+    }
+    m_Entities.pop_back();
+    m_Primary.pop_back();
+    m_Instances.pop_back();
+    SetDense(entity, InvalidIndex);
+}
+
+bool ComponentPool::Remove(EntityID entity)
+{
+    uint32_t index = FindDense(entity);
+    if (index == InvalidIndex)
+        return false;
+
+    // Destroy after the pool is consistent again, in case a destructor reaches back into it
+    std::vector<std::unique_ptr<TComponent>> removed = std::move(m_Instances[index]);
+    EraseDense(index);
+    return true;
+}
+
+bool ComponentPool::RemoveInstance(EntityID entity, const TComponent *component)
+{
+    uint32_t index = FindDense(entity);
+    if (index == InvalidIndex)
+        return false;
+
+    auto &instances = m_Instances[index];
+    auto it = std::find_if(instances.begin(), instances.end(),
+                           [&](const std::unique_ptr<TComponent> &ptr) { return ptr.get() == component; });
+    if (it == instances.end())
+        return false;
+
+    std::unique_ptr<TComponent> removed = std::move(*it);
+    instances.erase(it);
+    if (instances.empty())
+        EraseDense(index);
+    else
+        m_Primary[index] = instances.front().get();
+    return true;
+}
+
+} // namespace TE
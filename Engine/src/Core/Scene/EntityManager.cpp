@@ -6,25 +6,79 @@ namespace TE
 
 Entity TComponent::GetOwnerEntity() const { return Entity((EntityID)Owner, Manager); }
 
+void TComponent::NotifyHierarchyChanged()
+{
+    if (Manager)
+        Manager->MarkStructureChanged();
+}
+
 Entity EntityManager::CreateEntity()
 {
-    EntityID id = m_NextEntityID++;
-    m_AliveEntities.insert(id);
+    uint32_t slot;
+    if (!m_FreeSlots.empty())
+    {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        slot = (uint32_t)m_Slots.size();
+        m_Slots.emplace_back();
+    }
+
+    // Appending keeps the alive array in creation order; compact first so positions stay exact
+    GetAliveEntities();
+    EntityID id = MakeEntityID(slot, m_Slots[slot].Generation);
+    m_Slots[slot].AlivePosition = (uint32_t)m_AliveEntities.size();
+    m_AliveEntities.push_back(id);
+    MarkStructureChanged();
     return Entity(id, this);
 }
 
 void EntityManager::DestroyEntity(Entity entity)
 {
     EntityID id = entity.GetID();
-    m_AliveEntities.erase(id);
+    if (!IsValid(id))
+        return;
+
     RemoveAllComponents(id);
+
+    EntitySlot &slot = m_Slots[GetEntitySlot(id)];
+    m_AliveEntities[slot.AlivePosition] = 0;
+    m_DeadAliveEntries++;
+    slot.AlivePosition = InvalidPosition;
+    slot.Generation++; // Invalidates every outstanding handle to this slot
+    m_FreeSlots.push_back(GetEntitySlot(id));
+    MarkStructureChanged();
+}
+
+const std::vector<EntityID> &EntityManager::GetAliveEntities() const
+{
+    if (m_DeadAliveEntries == 0)
+        return m_AliveEntities;
+
+    size_t write = 0;
+    for (EntityID id : m_AliveEntities)
+    {
+        if (id == 0)
+            continue;
+        m_Slots[GetEntitySlot(id)].AlivePosition = (uint32_t)write;
+        m_AliveEntities[write++] = id;
+    }
+    m_AliveEntities.resize(write);
+    m_DeadAliveEntries = 0;
+    return m_AliveEntities;
 }
 
 void EntityManager::RemoveAllComponents(EntityID entityID)
 {
     for (auto &[type, pool] : m_ComponentPools)
     {
-        pool.erase(entityID);
+        if (pool.Remove(entityID))
+        {
+            RefreshQueries(type, entityID);
+            MarkStructureChanged();
+        }
     }
 }
 
@@ -42,25 +96,26 @@ void EntityManager::RemoveComponentInstance(EntityID entityID, TComponent *insta
 
     // Detach from parent
     instance->SetComponentParent(nullptr);
+    MarkStructureChanged();
 
     auto itIndex = m_ComponentPools.find(std::type_index(typeid(*instance)));
     if (itIndex != m_ComponentPools.end())
     {
-        auto &entityPool = itIndex->second;
-        auto compIt = entityPool.find(entityID);
-        if (compIt != entityPool.end())
-        {
-            auto &pool = compIt->second;
-            auto it = std::find_if(pool.begin(), pool.end(),
-                                   [&](const std::unique_ptr<TComponent> &ptr) { return ptr.get() == instance; });
-            if (it != pool.end())
-            {
-                pool.erase(it);
-            }
-        }
+        // Queries only change when the last instance of the type goes away
+        if (itIndex->second.RemoveInstance(entityID, instance) && !itIndex->second.Contains(entityID))
+            RefreshQueries(itIndex->first, entityID);
     }
 }
 
+void EntityManager::RefreshQueries(std::type_index type, EntityID entityID)
+{
+    auto it = m_QueriesByComponent.find(type);
+    if (it == m_QueriesByComponent.end())
+        return;
+    for (QueryCache *cache : it->second)
+        cache->Refresh(entityID);
+}
+
 // Template methods are defined in the header.
 
 } // namespace TE
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "Core/Scene/QueryCache.hpp"
+#include <utility>
+
+namespace TE
+{
+
+QueryCache::QueryCache(std::vector<const ComponentPool *> pools) : m_Pools(std::move(pools))
+{
+    // Seed from the smallest pool; every later change arrives through Refresh/Remove
+    const ComponentPool *driver = nullptr;
+    for (const ComponentPool *pool : m_Pools)
+    {
+        if (!driver || pool->Size() < driver->Size())
+            driver = pool;
+    }
+    if (!driver)
+        return;
+
+    const EntityID *entities = driver->GetEntities();
+    for (size_t i = 0; i < driver->Size(); ++i)
+        Refresh(entities[i]);
+}
+
+bool QueryCache::Matches(EntityID entity) const
+{
+    for (const ComponentPool *pool : m_Pools)
+    {
+        if (!pool->Contains(entity))
+            return false;
+    }
+    return true;
+}
+
+void QueryCache::Refresh(EntityID entity)
+{
+    bool contained = Contains(entity);
+    bool matches = Matches(entity);
+    if (contained == matches)
+        return;
+    if (!matches)
+    {
+        Remove(entity);
+        return;
+    }
+
+    uint32_t slot = GetEntitySlot(entity);
+    if (slot >= m_Index.size())
+        m_Index.resize((size_t)slot + 1, InvalidIndex);
+    m_Index[slot] = (uint32_t)m_Entities.size();
+    m_Entities.push_back(entity);
+}
+
+void QueryCache::Remove(EntityID entity)
+{
+    uint32_t index = FindIndex(entity);
+    if (index == InvalidIndex)
+        return;
+
+    EntityID last = m_Entities.back();
+    m_Entities[index] = last;
+    m_Index[GetEntitySlot(last)] = index;
+    m_Entities.pop_back();
+    m_Index[GetEntitySlot(entity)] = InvalidIndex;
+}
+
+} // namespace TE
@@ -75,7 +75,7 @@ bool SceneSerializer::Deserialize(const std::filesystem::path &filepath)
     auto &entityManager = m_Scene->GetEntityManager();
 
     // Clear existing entities before deserializing
-    std::set<EntityID> alive = entityManager.GetAliveEntities();
+    std::vector<EntityID> alive = entityManager.GetAliveEntities();
     for (EntityID id : alive)
     {
         entityManager.DestroyEntity(Entity(id, &entityManager));
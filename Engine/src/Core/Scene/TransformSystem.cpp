@@ -0,0 +1,118 @@
+#include "Core/Scene/TransformSystem.hpp"
+#include "Core/Scene/EntityManager.hpp"
+#include "Core/Scene/TransformComponent.hpp"
+#include <algorithm>
+
+namespace TE
+{
+
+uint32_t TransformSystem::AddNode(TComponent *component, int32_t parent)
+{
+    uint32_t index = (uint32_t)m_Nodes.size();
+    m_Nodes.push_back(component);
+    m_Parents.push_back(parent);
+    m_LocalSource.push_back(component->Transform);
+    m_World.emplace_back(1.0f);
+    m_Dirty.push_back(1);
+    m_NodeIndex[component] = index;
+    return index;
+}
+
+void TransformSystem::Rebuild()
+{
+    m_Nodes.clear();
+    m_Parents.clear();
+    m_LocalSource.clear();
+    m_World.clear();
+    m_Dirty.clear();
+    m_NodeIndex.clear();
+
+    std::vector<TComponent *> components;
+    std::vector<std::pair<TComponent *, int32_t>> stack;
+    for (EntityID id : m_EntityManager.GetAliveEntities())
+    {
+        auto *transform = m_EntityManager.GetComponent<TransformComponent>(id);
+        if (!transform)
+            continue;
+
+        int32_t root = (int32_t)AddNode(transform, -1);
+
+        // Depth-first from each root component keeps every parent ahead of its children
+        components.clear();
+        m_EntityManager.GetAllComponents(id, components);
+        for (TComponent *component : components)
+        {
+            if (component == transform || component->GetParentComponent())
+                continue;
+
+            stack.push_back({component, root});
+            while (!stack.empty())
+            {
+                auto [node, parent] = stack.back();
+                stack.pop_back();
+                int32_t index = (int32_t)AddNode(node, parent);
+                const auto &children = node->GetChildrenComponents();
+                for (auto it = children.rbegin(); it != children.rend(); ++it)
+                    stack.push_back({*it, index});
+            }
+        }
+    }
+
+    m_BuiltVersion = m_EntityManager.GetStructureVersion();
+}
+
+void TransformSystem::Update()
+{
+    if (m_BuiltVersion != m_EntityManager.GetStructureVersion())
+        Rebuild();
+
+    uint32_t recomputed = 0;
+    for (size_t i = 0; i < m_Nodes.size(); ++i)
+    {
+        const TETransform &local = m_Nodes[i]->Transform;
+        if (local != m_LocalSource[i])
+        {
+            m_LocalSource[i] = local;
+            m_Dirty[i] = 1;
+        }
+
+        // Parents come first, so their dirty flag is final by the time a child reads it
+        int32_t parent = m_Parents[i];
+        if (parent >= 0 && m_Dirty[parent])
+            m_Dirty[i] = 1;
+        if (!m_Dirty[i])
+            continue;
+
+        TEMatrix4 localMatrix = m_LocalSource[i].GetMatrix();
+        m_World[i] = parent >= 0 ? m_World[parent] * localMatrix : localMatrix;
+        recomputed++;
+    }
+
+    std::fill(m_Dirty.begin(), m_Dirty.end(), 0);
+    m_LastRecomputeCount = recomputed;
+}
+
+void TransformSystem::MarkDirty(const TComponent *component)
+{
+    auto it = m_NodeIndex.find(component);
+    if (it != m_NodeIndex.end())
+        m_Dirty[it->second] = 1;
+}
+
+TEMatrix4 TransformSystem::GetWorldMatrix(const TComponent *component) const
+{
+    auto it = m_NodeIndex.find(component);
+    if (it != m_NodeIndex.end() && m_BuiltVersion == m_EntityManager.GetStructureVersion())
+        return m_World[it->second];
+
+    // Not cached yet: walk the chain the same way the hierarchy does
+    TEMatrix4 model(1.0f);
+    const TComponent *transform = component->GetOwnerEntity().GetComponent<TransformComponent>();
+    for (const TComponent *curr = component; curr && curr != transform; curr = curr->GetParentComponent())
+        model = curr->Transform.GetMatrix() * model;
+    if (transform)
+        model = transform->Transform.GetMatrix() * model;
+    return model;
+}
+
+} // namespace TE
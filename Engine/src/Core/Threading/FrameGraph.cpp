@@ -0,0 +1,169 @@
+#include "Core/Threading/FrameGraph.hpp"
+#include "Core/Threading/JobSystem.hpp"
+#include <algorithm>
+
+namespace TE
+{
+
+size_t FrameGraph::AddPass(const std::string &name, std::initializer_list<const char *> reads,
+                           std::initializer_list<const char *> writes, PassFunc func, bool mainThread)
+{
+    Pass pass;
+    pass.Name = name;
+    for (const char *resource : reads)
+        pass.Reads.push_back(GetResource(resource));
+    for (const char *resource : writes)
+        pass.Writes.push_back(GetResource(resource));
+    pass.Func = std::move(func);
+    pass.MainThread = mainThread;
+
+    m_Passes.push_back(std::move(pass));
+    m_Compiled = false;
+    return m_Passes.size() - 1;
+}
+
+void FrameGraph::Clear()
+{
+    m_Passes.clear();
+    m_Resources.clear();
+    m_Timeline.clear();
+    m_Compiled = false;
+}
+
+uint32_t FrameGraph::GetResource(const char *name)
+{
+    auto it = std::find(m_Resources.begin(), m_Resources.end(), name);
+    if (it != m_Resources.end())
+        return (uint32_t)(it - m_Resources.begin());
+    m_Resources.emplace_back(name);
+    return (uint32_t)m_Resources.size() - 1;
+}
+
+void FrameGraph::Compile()
+{
+    // Walk the passes in order, tracking each resource's last writer and the readers since it
+    std::vector<int64_t> lastWriter(m_Resources.size(), -1);
+    std::vector<std::vector<uint32_t>> readers(m_Resources.size());
+
+    for (Pass &pass : m_Passes)
+    {
+        pass.Dependents.clear();
+        pass.DependencyCount = 0;
+    }
+
+    std::vector<uint32_t> dependencies;
+    for (uint32_t index = 0; index < m_Passes.size(); ++index)
+    {
+        Pass &pass = m_Passes[index];
+        dependencies.clear();
+
+        for (uint32_t resource : pass.Reads)
+        {
+            if (lastWriter[resource] >= 0)
+                dependencies.push_back((uint32_t)lastWriter[resource]);
+        }
+        for (uint32_t resource : pass.Writes)
+        {
+            if (lastWriter[resource] >= 0)
+                dependencies.push_back((uint32_t)lastWriter[resource]);
+            dependencies.insert(dependencies.end(), readers[resource].begin(), readers[resource].end());
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+        dependencies.erase(std::remove(dependencies.begin(), dependencies.end(), index), dependencies.end());
+        for (uint32_t dependency : dependencies)
+            m_Passes[dependency].Dependents.push_back(index);
+        pass.DependencyCount = (uint32_t)dependencies.size();
+
+        for (uint32_t resource : pass.Reads)
+            readers[resource].push_back(index);
+        for (uint32_t resource : pass.Writes)
+        {
+            lastWriter[resource] = index;
+            readers[resource].clear();
+        }
+    }
+
+    m_Remaining = std::make_unique<std::atomic<uint32_t>[]>(m_Passes.size());
+    m_Timeline.resize(m_Passes.size());
+    for (size_t index = 0; index < m_Passes.size(); ++index)
+        m_Timeline[index].Name = m_Passes[index].Name;
+    m_MainReady.reserve(m_Passes.size());
+    m_Compiled = true;
+}
+
+void FrameGraph::Execute()
+{
+    if (m_Passes.empty())
+        return;
+    if (!m_Compiled)
+        Compile();
+
+    m_FrameStart = std::chrono::high_resolution_clock::now();
+    for (size_t index = 0; index < m_Passes.size(); ++index)
+        m_Remaining[index].store(m_Passes[index].DependencyCount, std::memory_order_relaxed);
+    m_Outstanding.store((uint32_t)m_Passes.size(), std::memory_order_release);
+    m_MainReady.clear();
+    m_MainNext = 0;
+
+    for (uint32_t index = 0; index < m_Passes.size(); ++index)
+    {
+        if (m_Passes[index].DependencyCount == 0)
+            Launch(index);
+    }
+
+    // Run main-thread passes as they become ready and help with the other jobs in between. Worker passes are
+    // High, and helping stops there so a long Normal or Low job cannot hold back a main pass that becomes ready.
+    while (m_Outstanding.load(std::memory_order_acquire) != 0)
+    {
+        uint32_t ready = UINT32_MAX;
+        {
+            std::lock_guard<std::mutex> lock(m_MainMutex);
+            if (m_MainNext < m_MainReady.size())
+                ready = m_MainReady[m_MainNext++];
+        }
+
+        if (ready != UINT32_MAX)
+            RunPass(ready);
+        else if (!JobSystem::RunPendingJob(JobPriority::High))
+            std::this_thread::yield();
+    }
+
+    m_LastFrameMs =
+        std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - m_FrameStart).count();
+}
+
+void FrameGraph::Launch(uint32_t pass)
+{
+    if (m_Passes[pass].MainThread)
+    {
+        std::lock_guard<std::mutex> lock(m_MainMutex);
+        m_MainReady.push_back(pass);
+        return;
+    }
+    JobSystem::Run([this, pass] { RunPass(pass); }, JobPriority::High);
+}
+
+void FrameGraph::RunPass(uint32_t pass)
+{
+    FrameTimelineEntry &entry = m_Timeline[pass];
+    entry.Thread = std::max(JobSystem::GetCurrentWorkerIndex(), 0);
+    auto start = std::chrono::high_resolution_clock::now();
+    entry.StartMs = std::chrono::duration<float, std::milli>(start - m_FrameStart).count();
+
+    if (m_Passes[pass].Func)
+        m_Passes[pass].Func();
+
+    entry.EndMs =
+        std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - m_FrameStart).count();
+
+    for (uint32_t dependent : m_Passes[pass].Dependents)
+    {
+        if (m_Remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            Launch(dependent);
+    }
+    m_Outstanding.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace TE
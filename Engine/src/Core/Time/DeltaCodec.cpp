@@ -0,0 +1,69 @@
+#include "Core/Time/DeltaCodec.hpp"
+#include <cstring>
+
+namespace TE
+{
+
+// Delta layout: tokens of (uint16 zero run, uint16 literal count, literal bytes) over state ^ base.
+// Mid-stream tokens cover at least three bytes, which bounds the encoded size.
+size_t DeltaCodec::MaxEncodedSize(size_t size) { return (size / 3 + 2) * 4 + size; }
+
+static void WriteU16(uint8_t *&cursor, uint16_t value)
+{
+    std::memcpy(cursor, &value, sizeof(value));
+    cursor += sizeof(value);
+}
+
+size_t DeltaCodec::Encode(const uint8_t *base, const uint8_t *state, size_t size, uint8_t *out)
+{
+    uint8_t *cursor = out;
+    size_t i = 0;
+    while (i < size)
+    {
+        size_t zeros = 0;
+        while (i < size && zeros < 0xFFFF && state[i] == base[i])
+        {
+            ++zeros;
+            ++i;
+        }
+
+        // A literal run ends at the next pair of unchanged bytes; lone ones are cheaper to keep inline
+        size_t literalStart = i, literals = 0;
+        while (i < size && literals < 0xFFFF &&
+               !(state[i] == base[i] && (i + 1 >= size || state[i + 1] == base[i + 1])))
+        {
+            ++literals;
+            ++i;
+        }
+
+        WriteU16(cursor, (uint16_t)zeros);
+        WriteU16(cursor, (uint16_t)literals);
+        for (size_t j = literalStart; j < literalStart + literals; ++j)
+            *cursor++ = (uint8_t)(state[j] ^ base[j]);
+    }
+    return (size_t)(cursor - out);
+}
+
+bool DeltaCodec::Apply(uint8_t *state, size_t size, const uint8_t *delta, size_t deltaSize)
+{
+    const uint8_t *cursor = delta, *end = delta + deltaSize;
+    size_t i = 0;
+    while (cursor < end)
+    {
+        uint16_t zeros = 0, literals = 0;
+        if ((size_t)(end - cursor) < 2 * sizeof(uint16_t))
+            return false;
+        std::memcpy(&zeros, cursor, sizeof(zeros));
+        std::memcpy(&literals, cursor + sizeof(zeros), sizeof(literals));
+        cursor += 2 * sizeof(uint16_t);
+
+        i += zeros;
+        if (i + literals > size || (size_t)(end - cursor) < literals)
+            return false;
+        for (uint16_t j = 0; j < literals; ++j)
+            state[i++] ^= *cursor++;
+    }
+    return i == size;
+}
+
+} // namespace TE
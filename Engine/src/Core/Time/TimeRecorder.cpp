@@ -0,0 +1,388 @@
+#include "Core/Time/TimeRecorder.hpp"
+#include "Core/Log.h"
+#include "Core/Physics/PhysicsWorld.hpp"
+#include "Core/Scene/ComponentRegistry.hpp"
+#include "Core/Scene/EntityManager.hpp"
+#include "Core/Time/DeltaCodec.hpp"
+#include "Layers/ProfilingLayer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace TE
+{
+
+static_assert(std::is_trivially_copyable<TETransform>::value, "TETransform is recorded with memcpy");
+
+static constexpr int s_MaxTicksPerUpdate = 4;
+
+// Frame layout: uint32 type count, then per tracked type a uint32 entity count followed by, per entity,
+// its EntityID, a uint32 instance count and each instance's transform and fields. The physics snapshot comes
+// last as a uint32 size and its bytes; the size is 0 when there is none.
+template <typename T> static void Write(uint8_t *&cursor, const T &value)
+{
+    std::memcpy(cursor, &value, sizeof(T));
+    cursor += sizeof(T);
+}
+
+template <typename T> static bool Read(const uint8_t *&cursor, const uint8_t *end, T &value)
+{
+    if ((size_t)(end - cursor) < sizeof(T))
+        return false;
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+TimeRecorder::TimeRecorder(EntityManager &entityManager, size_t budgetBytes, float historySeconds, float tickRate,
+                           size_t keyframeInterval)
+    : m_EntityManager(entityManager), m_Arena(budgetBytes),
+      m_KeyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1), m_TickRate(tickRate > 0.0f ? tickRate : 60.0f)
+{
+    size_t frames = (size_t)std::ceil(std::max(historySeconds, 0.0f) * m_TickRate);
+    m_Frames.resize(frames > 0 ? frames : 1);
+}
+
+bool TimeRecorder::Track(const std::string &className)
+{
+    const ComponentMetadata *meta = ComponentRegistry::Get().GetMetadata(className);
+    if (!meta || meta->TypeIndex == std::type_index(typeid(void)))
+        return false;
+
+    for (const TrackedType &type : m_Types)
+    {
+        if (type.Type == meta->TypeIndex)
+            return true;
+    }
+
+    TrackedType type{className, meta->TypeIndex, {}, sizeof(TETransform)};
+    for (const PropertyMetadata &prop : meta->Properties)
+    {
+        if (prop.AddressFunc && prop.Size > 0)
+        {
+            type.Fields.push_back({prop.AddressFunc, prop.Size});
+            type.InstanceSize += prop.Size;
+        }
+    }
+    m_Types.push_back(std::move(type));
+    Clear();
+    return true;
+}
+
+void TimeRecorder::TrackAllRegistered()
+{
+    for (const auto &[name, meta] : ComponentRegistry::Get().GetComponents())
+        Track(name);
+}
+
+void TimeRecorder::SetPhysicsWorld(PhysicsWorld *world)
+{
+    m_PhysicsWorld = world;
+    Clear();
+}
+
+int TimeRecorder::Update(float deltaTime)
+{
+    const float tick = 1.0f / m_TickRate;
+    if (deltaTime > 0.0f)
+        m_Accumulator += deltaTime;
+
+    int recorded = 0;
+    while (m_Accumulator >= tick && recorded < s_MaxTicksPerUpdate)
+    {
+        Record();
+        m_Accumulator -= tick;
+        ++recorded;
+    }
+
+    // Over budget: skip the missed ticks rather than spiral
+    if (m_Accumulator >= tick)
+        m_Accumulator = std::fmod(m_Accumulator, tick);
+
+    return recorded;
+}
+
+void TimeRecorder::Capture()
+{
+    m_PhysicsState.clear();
+    if (m_PhysicsWorld && m_PhysicsWorld->GetSoftBodyCount() == 0)
+        m_PhysicsWorld->CaptureState(m_PhysicsState);
+
+    size_t size = 2 * sizeof(uint32_t) + m_PhysicsState.size();
+    for (const TrackedType &type : m_Types)
+    {
+        size += sizeof(uint32_t);
+        const ComponentPool *pool = m_EntityManager.GetPool(type.Type);
+        for (size_t i = 0, count = pool ? pool->Size() : 0; i < count; ++i)
+            size += sizeof(EntityID) + sizeof(uint32_t) + pool->GetInstances(i).size() * type.InstanceSize;
+    }
+    m_Current.resize(size);
+
+    uint8_t *cursor = m_Current.data();
+    Write(cursor, (uint32_t)m_Types.size());
+    for (const TrackedType &type : m_Types)
+    {
+        const ComponentPool *pool = m_EntityManager.GetPool(type.Type);
+        size_t count = pool ? pool->Size() : 0;
+        Write(cursor, (uint32_t)count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto &instances = pool->GetInstances(i);
+            Write(cursor, pool->GetEntities()[i]);
+            Write(cursor, (uint32_t)instances.size());
+            for (const auto &instance : instances)
+            {
+                Write(cursor, instance->Transform);
+                for (const Field &field : type.Fields)
+                {
+                    std::memcpy(cursor, field.Address(instance.get()), field.Size);
+                    cursor += field.Size;
+                }
+            }
+        }
+    }
+
+    Write(cursor, (uint32_t)m_PhysicsState.size());
+    if (!m_PhysicsState.empty())
+        std::memcpy(cursor, m_PhysicsState.data(), m_PhysicsState.size());
+}
+
+bool TimeRecorder::Record()
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Capture();
+    const size_t size = m_Current.size();
+    if (m_Restored.capacity() < size)
+        m_Restored.reserve(size); // Keeps restores allocation-free, they run while scrubbing
+
+    // A delta needs its base frame in the buffer and the same layout; otherwise, or when it would not be
+    // smaller, the frame is stored whole
+    bool keyframe = m_Count == 0 || m_SinceKeyframe + 1 >= m_KeyframeInterval || size != m_Previous.size();
+    size_t encodedSize = 0;
+    if (!keyframe)
+    {
+        if (m_Encoded.size() < DeltaCodec::MaxEncodedSize(size))
+            m_Encoded.resize(DeltaCodec::MaxEncodedSize(size));
+        encodedSize = DeltaCodec::Encode(m_Previous.data(), m_Current.data(), size, m_Encoded.data());
+        keyframe = encodedSize >= size;
+    }
+
+    size_t offset = 0;
+    if (!Allocate(keyframe ? size : encodedSize, offset))
+    {
+        TE_CORE_WARN("TimeRecorder: a {0} byte frame does not fit the {1} byte budget", size, m_Arena.size());
+        return false;
+    }
+    if (!keyframe && m_Count == 0)
+    {
+        // Eviction took the base frame with it
+        keyframe = true;
+        if (!Allocate(size, offset))
+            return false;
+    }
+
+    const uint8_t *payload = keyframe ? m_Current.data() : m_Encoded.data();
+    const size_t payloadSize = keyframe ? size : encodedSize;
+    std::memcpy(m_Arena.data() + offset, payload, payloadSize);
+
+    m_Frames[(m_First + m_Count) % m_Frames.size()] = {offset, payloadSize, keyframe};
+    m_Count++;
+    m_WriteOffset = offset + payloadSize;
+    m_BytesUsed += payloadSize;
+    m_SinceKeyframe = keyframe ? 0 : m_SinceKeyframe + 1;
+    m_Previous.swap(m_Current);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_LastRecordMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    ReportStats();
+    return true;
+}
+
+bool TimeRecorder::Allocate(size_t size, size_t &outOffset)
+{
+    if (size > m_Arena.size())
+        return false;
+
+    if (m_Count == m_Frames.size())
+        EvictOldest();
+
+    size_t offset = m_Count > 0 ? m_WriteOffset : 0;
+    if (offset + size > m_Arena.size())
+    {
+        // Frames past the write position are left over from the previous lap and are the oldest
+        while (m_Count > 0 && GetFrame(0).Offset >= offset)
+            EvictOldest();
+        offset = 0;
+    }
+
+    // Walking forward from the write position meets frames oldest first
+    while (m_Count > 0)
+    {
+        const Frame &oldest = GetFrame(0);
+        if (oldest.Offset >= offset + size || oldest.Offset + oldest.Size <= offset)
+            break;
+        EvictOldest();
+    }
+
+    outOffset = offset;
+    return true;
+}
+
+void TimeRecorder::EvictOldest()
+{
+    // Deltas are useless without the keyframe they chain from, so they go with it
+    do
+    {
+        m_BytesUsed -= GetFrame(0).Size;
+        m_First = (m_First + 1) % m_Frames.size();
+        m_Count--;
+    } while (m_Count > 0 && !GetFrame(0).Keyframe);
+}
+
+size_t TimeRecorder::AgeFromSeconds(float secondsAgo) const
+{
+    size_t age = (size_t)std::lround(std::max(secondsAgo, 0.0f) * m_TickRate);
+    return std::min(age, m_Count - 1);
+}
+
+bool TimeRecorder::Scrub(float secondsAgo)
+{
+    if (m_Count == 0)
+        return false;
+    return Restore(AgeFromSeconds(secondsAgo), false);
+}
+
+bool TimeRecorder::Rewind(float secondsAgo)
+{
+    if (m_Count == 0)
+        return false;
+
+    size_t age = AgeFromSeconds(secondsAgo);
+    if (!Restore(age, true))
+        return false;
+
+    for (size_t i = 0; i < age; ++i)
+        m_BytesUsed -= GetFrame(m_Count - 1 - i).Size;
+    m_Count -= age;
+
+    const Frame &newest = GetFrame(m_Count - 1);
+    m_WriteOffset = newest.Offset + newest.Size;
+    m_SinceKeyframe = 0;
+    for (size_t i = m_Count - 1; i > 0 && !GetFrame(i).Keyframe; --i)
+        m_SinceKeyframe++;
+
+    m_Previous.resize(m_Restored.size());
+    std::memcpy(m_Previous.data(), m_Restored.data(), m_Restored.size());
+    m_Accumulator = 0.0f;
+    ReportStats();
+    return true;
+}
+
+bool TimeRecorder::Restore(size_t age, bool restorePhysics)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    size_t target = m_Count - 1 - age;
+    size_t keyframe = target;
+    while (!GetFrame(keyframe).Keyframe)
+        --keyframe; // The oldest frame is always a keyframe
+
+    const Frame &base = GetFrame(keyframe);
+    m_Restored.resize(base.Size);
+    std::memcpy(m_Restored.data(), m_Arena.data() + base.Offset, base.Size);
+    for (size_t i = keyframe + 1; i <= target; ++i)
+    {
+        const Frame &delta = GetFrame(i);
+        if (!DeltaCodec::Apply(m_Restored.data(), m_Restored.size(), m_Arena.data() + delta.Offset, delta.Size))
+        {
+            TE_CORE_ERROR("TimeRecorder: corrupt delta frame");
+            return false;
+        }
+    }
+    Apply(m_Restored, restorePhysics);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    m_LastRestoreMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    ReportStats();
+    return true;
+}
+
+void TimeRecorder::Apply(const std::vector<uint8_t> &state, bool restorePhysics)
+{
+    const uint8_t *cursor = state.data(), *end = state.data() + state.size();
+    uint32_t typeCount = 0;
+    if (!Read(cursor, end, typeCount) || typeCount != m_Types.size())
+        return;
+
+    for (const TrackedType &type : m_Types)
+    {
+        const ComponentPool *pool = m_EntityManager.GetPool(type.Type);
+        uint32_t entityCount = 0;
+        if (!Read(cursor, end, entityCount))
+            return;
+
+        for (uint32_t e = 0; e < entityCount; ++e)
+        {
+            EntityID entity = 0;
+            uint32_t instanceCount = 0;
+            if (!Read(cursor, end, entity) || !Read(cursor, end, instanceCount) ||
+                (size_t)(end - cursor) < instanceCount * type.InstanceSize)
+                return;
+
+            // Stale generations miss in the pool, so destroyed entities are skipped
+            const auto *instances = pool ? pool->GetAll(entity) : nullptr;
+            for (uint32_t i = 0; i < instanceCount; ++i, cursor += type.InstanceSize)
+            {
+                if (!instances || i >= instances->size())
+                    continue;
+
+                TComponent *component = (*instances)[i].get();
+                const uint8_t *field = cursor;
+                std::memcpy(&component->Transform, field, sizeof(TETransform));
+                field += sizeof(TETransform);
+                for (const Field &f : type.Fields)
+                {
+                    std::memcpy(f.Address(component), field, f.Size);
+                    field += f.Size;
+                }
+            }
+        }
+    }
+
+    uint32_t physicsSize = 0;
+    if (!restorePhysics || !Read(cursor, end, physicsSize) || (size_t)(end - cursor) < physicsSize)
+        return;
+    if (m_PhysicsWorld && physicsSize > 0)
+    {
+        m_PhysicsState.assign(cursor, cursor + physicsSize);
+        m_PhysicsWorld->RestoreState(m_PhysicsState);
+    }
+}
+
+void TimeRecorder::Clear()
+{
+    m_First = 0;
+    m_Count = 0;
+    m_WriteOffset = 0;
+    m_BytesUsed = 0;
+    m_SinceKeyframe = 0;
+    m_Accumulator = 0.0f;
+    m_Previous.clear();
+}
+
+float TimeRecorder::GetMemoryPerSecond() const
+{
+    float seconds = GetRecordedSeconds();
+    return seconds > 0.0f ? (float)m_BytesUsed / seconds : 0.0f;
+}
+
+void TimeRecorder::ReportStats() const
+{
+    if (auto *profiler = ProfilingLayer::GetInstance())
+        profiler->RecordRewindStats(GetRecordedSeconds(), GetMemoryPerSecond(), m_LastRestoreMs);
+}
+
+} // namespace TE
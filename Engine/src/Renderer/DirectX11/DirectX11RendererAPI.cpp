@@ -259,6 +259,11 @@ void DirectX11RendererAPI::DrawIndexed(uint32_t /*vao*/, uint32_t indexCount)
     DX11Context::Get().DeviceContext->DrawIndexed(indexCount, 0, 0);
 }
 
+void DirectX11RendererAPI::DrawIndexedInstanced(uint32_t /*vao*/, uint32_t indexCount, uint32_t instanceCount)
+{
+    DX11Context::Get().DeviceContext->DrawIndexedInstanced(indexCount, instanceCount, 0, 0, 0);
+}
+
 void DirectX11RendererAPI::SetBlendMode(int blendMode)
 {
     DX11Context &ctx = DX11Context::Get();
@@ -76,6 +76,19 @@ void DirectX11VertexArray::AddVertexBuffer(VertexBuffer *vertexBuffer)
     // This is wired up per-pipeline when DirectX11Shader::Bind() is called.
 }
 
+void DirectX11VertexArray::AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                             const std::vector<uint32_t> &componentCounts)
+{
+    m_InstanceBuffer = vertexBuffer;
+    // Instance streams live in input slot 1 and are described with D3D11_INPUT_PER_INSTANCE_DATA and an
+    // InstanceDataStepRate of 1, e.g. the batcher's transform/color/UV/slot stream:
+    //
+    //   { "INSTANCE_TRANSFORM", 0..3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offset, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+    //   { "INSTANCE_COLOR",     0,    DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64,     D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+    //
+    // Like the per-vertex layout, the input layout is wired up per-pipeline by DirectX11Shader.
+}
+
 void DirectX11VertexArray::SetIndexBuffer(IndexBuffer *indexBuffer)
 {
     m_IndexBuffer = indexBuffer;
@@ -2,11 +2,19 @@
 #include "Core/Log.h"
 #include "Renderer/MaterialSerializer.hpp"
 #include "Renderer/ShaderLibrary.hpp"
+#include <algorithm>
+#include <atomic>
 
 namespace TE
 {
 
-Material::Material(const std::shared_ptr<Shader> &shader) : m_Shader(shader), m_Color(TEColor::White()) {}
+static std::atomic<uint32_t> s_NextMaterialID{1};
+
+Material::Material(const std::shared_ptr<Shader> &shader)
+    : m_Shader(shader), m_Color(TEColor::White()),
+      m_MaterialID(s_NextMaterialID.fetch_add(1, std::memory_order_relaxed))
+{
+}
 
 Material::~Material() {}
 
@@ -18,31 +26,129 @@ void Material::SetShader(const std::shared_ptr<Shader> &shader) { m_Shader = sha
 
 std::shared_ptr<Shader> Material::GetShader() const { return m_Shader; }
 
-void Material::SetUniform(const std::string &name, float value) { m_FloatUniforms[name] = value; }
-void Material::SetUniform(const std::string &name, int value) { m_IntUniforms[name] = value; }
-void Material::SetUniform(const std::string &name, const glm::vec2 &value) { m_Vec2Uniforms[name] = value; }
-void Material::SetUniform(const std::string &name, const glm::vec3 &value) { m_Vec3Uniforms[name] = value; }
-void Material::SetUniform(const std::string &name, const glm::vec4 &value) { m_Vec4Uniforms[name] = value; }
-void Material::SetUniform(const std::string &name, const glm::mat4 &value) { m_Mat4Uniforms[name] = value; }
+// Only a new name invalidates the resolved handles; updating an existing value is picked up through the pointer
+template <typename T>
+static bool StoreUniform(std::unordered_map<std::string, T> &uniforms, const std::string &name, const T &value)
+{
+    return uniforms.insert_or_assign(name, value).second;
+}
+
+template <typename T, typename Resolved>
+static void ResolveMap(Shader *shader, const std::unordered_map<std::string, T> &uniforms, std::vector<Resolved> &out)
+{
+    out.clear();
+    for (auto const &[name, val] : uniforms)
+    {
+        UniformHandle handle = shader->GetUniformHandle(name);
+        if (handle.IsValid())
+            out.push_back({handle, &val});
+    }
+}
+
+void Material::SetUniform(const std::string &name, float value)
+{
+    if (StoreUniform(m_FloatUniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+void Material::SetUniform(const std::string &name, int value)
+{
+    if (StoreUniform(m_IntUniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+void Material::SetUniform(const std::string &name, const glm::vec2 &value)
+{
+    if (StoreUniform(m_Vec2Uniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+void Material::SetUniform(const std::string &name, const glm::vec3 &value)
+{
+    if (StoreUniform(m_Vec3Uniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+void Material::SetUniform(const std::string &name, const glm::vec4 &value)
+{
+    if (StoreUniform(m_Vec4Uniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+void Material::SetUniform(const std::string &name, const glm::mat4 &value)
+{
+    if (StoreUniform(m_Mat4Uniforms, name, value))
+        m_ResolvedUniforms.clear();
+}
+
+const Material::ResolvedUniforms &Material::ResolveUniforms(Shader *shader)
+{
+    for (const auto &resolved : m_ResolvedUniforms)
+    {
+        if (resolved.ShaderID == shader->GetShaderID())
+            return resolved;
+    }
 
-void Material::ApplyUniforms()
+    ResolvedUniforms &resolved = m_ResolvedUniforms.emplace_back();
+    resolved.ShaderID = shader->GetShaderID();
+    ResolveMap(shader, m_FloatUniforms, resolved.Floats);
+    ResolveMap(shader, m_IntUniforms, resolved.Ints);
+    ResolveMap(shader, m_Vec2Uniforms, resolved.Vec2s);
+    ResolveMap(shader, m_Vec3Uniforms, resolved.Vec3s);
+    ResolveMap(shader, m_Vec4Uniforms, resolved.Vec4s);
+    ResolveMap(shader, m_Mat4Uniforms, resolved.Mat4s);
+    return resolved;
+}
+
+// Resolved lists follow map iteration order, which differs between materials, so entries are matched by handle
+template <typename T>
+static bool SameResolved(const std::vector<T> &a, const std::vector<T> &b)
 {
-    if (m_Shader)
+    if (a.size() != b.size())
+        return false;
+    for (const T &uniform : a)
     {
-        ShaderLibrary::SetColor(m_Shader.get(), m_Color);
-
-        for (auto const &[name, val] : m_FloatUniforms)
-            m_Shader->SetUniform1f(name, val);
-        for (auto const &[name, val] : m_IntUniforms)
-            m_Shader->SetUniform1i(name, val);
-        for (auto const &[name, val] : m_Vec2Uniforms)
-            m_Shader->SetUniform2f(name, val);
-        for (auto const &[name, val] : m_Vec3Uniforms)
-            m_Shader->SetUniform3f(name, val);
-        for (auto const &[name, val] : m_Vec4Uniforms)
-            m_Shader->SetUniform4f(name, val);
-        for (auto const &[name, val] : m_Mat4Uniforms)
-            m_Shader->SetUniformMat4(name, val);
+        auto match = std::find_if(b.begin(), b.end(),
+                                  [&](const T &other) { return other.Handle.Location == uniform.Handle.Location; });
+        if (match == b.end() || !(*match->Value == *uniform.Value))
+            return false;
+    }
+    return true;
+}
+
+bool Material::HasUniforms(Shader *shader)
+{
+    const ResolvedUniforms &resolved = ResolveUniforms(shader);
+    return !resolved.Floats.empty() || !resolved.Ints.empty() || !resolved.Vec2s.empty() ||
+           !resolved.Vec3s.empty() || !resolved.Vec4s.empty() || !resolved.Mat4s.empty();
+}
+
+bool Material::HasSameUniforms(Material &other, Shader *shader)
+{
+    if (&other == this)
+        return true;
+    const ResolvedUniforms &a = ResolveUniforms(shader);
+    const ResolvedUniforms &b = other.ResolveUniforms(shader);
+    return SameResolved(a.Floats, b.Floats) && SameResolved(a.Ints, b.Ints) && SameResolved(a.Vec2s, b.Vec2s) &&
+           SameResolved(a.Vec3s, b.Vec3s) && SameResolved(a.Vec4s, b.Vec4s) && SameResolved(a.Mat4s, b.Mat4s);
+}
+
+void Material::ApplyUniforms() { ApplyUniforms(m_Shader.get()); }
+
+void Material::ApplyUniforms(Shader *shader)
+{
+    if (shader)
+    {
+        ShaderLibrary::SetColor(shader, m_Color);
+
+        const ResolvedUniforms &resolved = ResolveUniforms(shader);
+        for (const auto &uniform : resolved.Floats)
+            shader->SetUniform1f(uniform.Handle, *uniform.Value);
+        for (const auto &uniform : resolved.Ints)
+            shader->SetUniform1i(uniform.Handle, *uniform.Value);
+        for (const auto &uniform : resolved.Vec2s)
+            shader->SetUniform2f(uniform.Handle, *uniform.Value);
+        for (const auto &uniform : resolved.Vec3s)
+            shader->SetUniform3f(uniform.Handle, *uniform.Value);
+        for (const auto &uniform : resolved.Vec4s)
+            shader->SetUniform4f(uniform.Handle, *uniform.Value);
+        for (const auto &uniform : resolved.Mat4s)
+            shader->SetUniformMat4(uniform.Handle, *uniform.Value);
     }
 }
 
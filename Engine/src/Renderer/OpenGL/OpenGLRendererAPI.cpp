@@ -29,6 +29,12 @@ void OpenGLRendererAPI::DrawIndexed(uint32_t vao, uint32_t indexCount)
     glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
 }
 
+void OpenGLRendererAPI::DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount)
+{
+    glBindVertexArray(vao);
+    glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+}
+
 void OpenGLRendererAPI::SetBlendMode(int blendMode)
 {
     glEnable(GL_BLEND);
@@ -45,6 +45,8 @@ OpenGLShader::OpenGLShader(const std::string &vertexSrc, const std::string &frag
 
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+
+    BuildUniformCache();
 }
 
 OpenGLShader::OpenGLShader(const std::string &computeSrc)
@@ -65,6 +67,45 @@ OpenGLShader::OpenGLShader(const std::string &computeSrc)
     }
 
     glDeleteShader(computeShader);
+
+    BuildUniformCache();
+}
+
+void OpenGLShader::BuildUniformCache()
+{
+    m_UniformLocations.clear();
+
+    int uniformCount = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+    char nameBuffer[256];
+    for (int i = 0; i < uniformCount; ++i)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_RendererID, (GLuint)i, sizeof(nameBuffer), &length, &size, &type, nameBuffer);
+
+        std::string name(nameBuffer, length);
+        int location = glGetUniformLocation(m_RendererID, name.c_str());
+        if (location == -1)
+            continue; // Uniform block members have no location
+
+        m_UniformLocations[name] = location;
+
+        // Arrays report "name[0]"; also register the bare name and every element
+        size_t bracket = name.find('[');
+        if (bracket != std::string::npos)
+        {
+            std::string baseName = name.substr(0, bracket);
+            m_UniformLocations[baseName] = location;
+            for (GLint element = 1; element < size; ++element)
+            {
+                std::string elementName = baseName + "[" + std::to_string(element) + "]";
+                m_UniformLocations[elementName] = glGetUniformLocation(m_RendererID, elementName.c_str());
+            }
+        }
+    }
 }
 
 OpenGLShader::~OpenGLShader() { glDeleteProgram(m_RendererID); }
@@ -75,30 +116,69 @@ void OpenGLShader::Unbind() const { glUseProgram(0); }
 
 int OpenGLShader::GetUniformLocation(const std::string &name)
 {
-    return glGetUniformLocation(m_RendererID, name.c_str());
+    auto it = m_UniformLocations.find(name);
+    return it != m_UniformLocations.end() ? it->second : -1;
 }
 
 void OpenGLShader::SetUniformMat4(const std::string &name, const glm::mat4 &value)
 {
-    glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    SetUniformMat4(GetUniformHandle(name), value);
 }
 
 void OpenGLShader::SetUniform4f(const std::string &name, const glm::vec4 &value)
 {
-    glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
+    SetUniform4f(GetUniformHandle(name), value);
 }
 
 void OpenGLShader::SetUniform3f(const std::string &name, const glm::vec3 &value)
 {
-    glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
+    SetUniform3f(GetUniformHandle(name), value);
 }
 
 void OpenGLShader::SetUniform2f(const std::string &name, const glm::vec2 &value)
 {
-    glUniform2f(GetUniformLocation(name), value.x, value.y);
+    SetUniform2f(GetUniformHandle(name), value);
+}
+
+void OpenGLShader::SetUniform1f(const std::string &name, float value) { SetUniform1f(GetUniformHandle(name), value); }
+
+void OpenGLShader::SetUniform1i(const std::string &name, int value) { SetUniform1i(GetUniformHandle(name), value); }
+
+UniformHandle OpenGLShader::GetUniformHandle(const std::string &name) { return {GetUniformLocation(name)}; }
+
+void OpenGLShader::SetUniformMat4(UniformHandle handle, const glm::mat4 &value)
+{
+    if (handle.IsValid())
+        glUniformMatrix4fv(handle.Location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void OpenGLShader::SetUniform4f(UniformHandle handle, const glm::vec4 &value)
+{
+    if (handle.IsValid())
+        glUniform4f(handle.Location, value.x, value.y, value.z, value.w);
+}
+
+void OpenGLShader::SetUniform3f(UniformHandle handle, const glm::vec3 &value)
+{
+    if (handle.IsValid())
+        glUniform3f(handle.Location, value.x, value.y, value.z);
 }
 
-void OpenGLShader::SetUniform1f(const std::string &name, float value) { glUniform1f(GetUniformLocation(name), value); }
+void OpenGLShader::SetUniform2f(UniformHandle handle, const glm::vec2 &value)
+{
+    if (handle.IsValid())
+        glUniform2f(handle.Location, value.x, value.y);
+}
 
-void OpenGLShader::SetUniform1i(const std::string &name, int value) { glUniform1i(GetUniformLocation(name), value); }
+void OpenGLShader::SetUniform1f(UniformHandle handle, float value)
+{
+    if (handle.IsValid())
+        glUniform1f(handle.Location, value);
+}
+
+void OpenGLShader::SetUniform1i(UniformHandle handle, int value)
+{
+    if (handle.IsValid())
+        glUniform1i(handle.Location, value);
+}
 } // namespace TE
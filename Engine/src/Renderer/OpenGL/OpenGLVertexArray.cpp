@@ -41,6 +41,29 @@ namespace TE {
 
 
 
+    void OpenGLVertexArray::AddInstanceBuffer(VertexBuffer* vertexBuffer, uint32_t firstLocation,
+        const std::vector<uint32_t>& componentCounts)
+    {
+        glBindVertexArray(m_RendererID);
+        vertexBuffer->Bind();
+
+        uint32_t stride = 0;
+        for (uint32_t count : componentCounts)
+            stride += count * sizeof(float);
+
+        uintptr_t offset = 0;
+        for (size_t i = 0; i < componentCounts.size(); ++i)
+        {
+            uint32_t location = firstLocation + static_cast<uint32_t>(i);
+            glEnableVertexAttribArray(location);
+            glVertexAttribPointer(location, componentCounts[i], GL_FLOAT, GL_FALSE, stride, (void*)offset);
+            glVertexAttribDivisor(location, 1); // advance once per instance
+            offset += componentCounts[i] * sizeof(float);
+        }
+
+        m_InstanceBuffer = vertexBuffer;
+    }
+
     void OpenGLVertexArray::SetIndexBuffer(IndexBuffer* indexBuffer) {
         m_IndexBuffer = indexBuffer;
         glBindVertexArray(m_RendererID);
@@ -24,6 +24,7 @@ namespace TE {
 
     void OpenGLVertexBuffer::SetData(float* vertices, uint32_t size) const
     {
-        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_DYNAMIC_DRAW);
     }
 }
@@ -53,6 +53,13 @@ void OpenGLESRendererAPI::DrawIndexed(uint32_t vao, uint32_t indexCount)
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr);
 }
 
+void OpenGLESRendererAPI::DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount)
+{
+    glBindVertexArray(vao);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr,
+                            static_cast<GLsizei>(instanceCount));
+}
+
 void OpenGLESRendererAPI::SetBlendMode(int blendMode)
 {
     glEnable(GL_BLEND);
@@ -33,6 +33,30 @@ void OpenGLESVertexArray::AddVertexBuffer(VertexBuffer *vertexBuffer)
     m_VertexBuffer = vertexBuffer;
 }
 
+void OpenGLESVertexArray::AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                            const std::vector<uint32_t> &componentCounts)
+{
+    glBindVertexArray(m_RendererID);
+    vertexBuffer->Bind();
+
+    GLsizei stride = 0;
+    for (uint32_t count : componentCounts)
+        stride += static_cast<GLsizei>(count * sizeof(float));
+
+    uintptr_t offset = 0;
+    for (size_t i = 0; i < componentCounts.size(); ++i)
+    {
+        GLuint location = firstLocation + static_cast<GLuint>(i);
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, static_cast<GLint>(componentCounts[i]), GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void *>(offset));
+        glVertexAttribDivisor(location, 1); // ES 3.0: advance once per instance
+        offset += componentCounts[i] * sizeof(float);
+    }
+
+    m_InstanceBuffer = vertexBuffer;
+}
+
 void OpenGLESVertexArray::SetIndexBuffer(IndexBuffer *indexBuffer)
 {
     glBindVertexArray(m_RendererID);
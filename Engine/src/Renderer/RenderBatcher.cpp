@@ -1,18 +1,95 @@
 #include "Renderer/RenderBatcher.hpp"
+#include "Core/Log.h"
 #include "Layers/ProfilingLayer.hpp"
 #include "Renderer/RenderCommand.hpp"
 #include "Renderer/ShaderLibrary.hpp"
+#include "Renderer/Texture.hpp"
 #include <chrono>
 
 namespace TE
 {
 
-void RenderBatcher::Begin() { m_DrawCommands.clear(); }
+static_assert(sizeof(BatchInstance) == 25 * sizeof(float), "BatchInstance must stay tightly packed for the GPU stream");
+
+void RenderBatcher::Init(const std::shared_ptr<VertexArray> &quadVAO)
+{
+    Init(quadVAO,
+         std::unique_ptr<VertexBuffer>(VertexBuffer::Create(nullptr, MaxInstancesPerDraw * sizeof(BatchInstance))));
+}
+
+void RenderBatcher::Init(const std::shared_ptr<VertexArray> &quadVAO, std::unique_ptr<VertexBuffer> instanceBuffer)
+{
+    m_InstanceBuffer = std::move(instanceBuffer);
+    m_InstanceScratch.reserve(MaxInstancesPerDraw);
+    RegisterMesh(quadVAO, 6);
+}
+
+uint32_t RenderBatcher::RegisterMesh(const std::shared_ptr<VertexArray> &vao, uint32_t indexCount)
+{
+    // A mesh ID must fit the sort key's mesh field below the arbitrary-mesh value
+    TE_CORE_ASSERT(m_Meshes.size() < RenderSortKey::ArbitraryMesh, "Too many meshes registered with RenderBatcher");
+
+    // mat4 transform (4 x vec4), color, uv rect, texture slot
+    if (vao && m_InstanceBuffer)
+        vao->AddInstanceBuffer(m_InstanceBuffer.get(), 1, {4, 4, 4, 4, 4, 4, 1});
+
+    m_Meshes.push_back({vao, indexCount});
+    return static_cast<uint32_t>(m_Meshes.size() - 1);
+}
+
+void RenderBatcher::Begin()
+{
+    m_DrawCommands.clear();
+    m_Instances.clear();
+    m_Queue.Clear();
+}
+
+void RenderBatcher::PushCommand(BatchDrawCommand &&cmd, uint32_t mesh)
+{
+    cmd.layer = m_CurrentLayer;
+
+    // Instances sort by the program they are drawn with. A material that uploads nothing to it besides the
+    // color (which travels per instance) gets no material ID, so such quads stay in one run across materials.
+    Shader *shader = cmd.material->GetShader().get();
+    uint32_t materialID = cmd.material->GetMaterialID();
+    if (cmd.instanceIndex >= 0)
+    {
+        shader = shader->GetInstancedVariant().get();
+        if (!cmd.material->HasUniforms(shader))
+            materialID = 0;
+    }
+    uint32_t shaderID = shader ? shader->GetShaderID() : 0;
+    uint32_t textureID = cmd.texture ? cmd.texture->GetRendererID() : 0;
+    uint64_t key = RenderSortKey::Make(cmd.layer, static_cast<uint32_t>(cmd.blendMode), shaderID, materialID, mesh,
+                                       textureID, cmd.transform[3][2]);
+    m_Queue.Push(key, static_cast<uint32_t>(m_DrawCommands.size()));
+    m_DrawCommands.push_back(std::move(cmd));
+}
 
 void RenderBatcher::Submit(const std::shared_ptr<VertexArray> &vao, const std::shared_ptr<Material> &material,
                            const glm::mat4 &transform, uint32_t indexCount, int blendMode)
 {
-    m_DrawCommands.push_back({vao, material, transform, indexCount, blendMode});
+    // Arbitrary meshes sort after every registered instanced mesh of the same material
+    PushCommand({vao, material, transform, indexCount, blendMode}, RenderSortKey::ArbitraryMesh);
+}
+
+void RenderBatcher::SubmitInstance(uint32_t mesh, const std::shared_ptr<Material> &material,
+                                   const glm::mat4 &transform, const glm::vec4 &color, int blendMode,
+                                   const std::shared_ptr<Texture> &texture, const glm::vec4 &uvRect)
+{
+    const InstancedMesh &instanced = m_Meshes[mesh];
+    const auto &shader = material->GetShader();
+    if (!m_InstanceBuffer || !shader || !shader->GetInstancedVariant())
+    {
+        Submit(instanced.vertexArray, material, transform, instanced.indexCount, blendMode);
+        return;
+    }
+
+    BatchDrawCommand cmd{instanced.vertexArray, material, transform, instanced.indexCount, blendMode};
+    cmd.instanceIndex = static_cast<int32_t>(m_Instances.size());
+    cmd.texture = texture;
+    PushCommand(std::move(cmd), mesh);
+    m_Instances.push_back({transform, color, uvRect, -1.0f});
 }
 
 void RenderBatcher::End()
@@ -24,16 +101,12 @@ void RenderBatcher::Flush()
 {
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Simple batching: sort by blendMode then material (shader pointer)
-    std::sort(m_DrawCommands.begin(), m_DrawCommands.end(),
-              [](const BatchDrawCommand &a, const BatchDrawCommand &b)
-              {
-                  if (a.blendMode != b.blendMode)
-                      return a.blendMode < b.blendMode;
-                  return a.material->GetShader().get() < b.material->GetShader().get();
-              });
+    // Key order is layer, blend mode, shader, material, texture, depth; equal keys keep submission order
+    m_Queue.Sort();
+    const std::vector<RenderQueueEntry> &entries = m_Queue.GetEntries();
 
-    std::shared_ptr<Material> lastMaterial = nullptr;
+    Shader *boundShader = nullptr;
+    Material *appliedMaterial = nullptr;
     int lastBlendMode = 0;
 
     // Default blending
@@ -42,35 +115,109 @@ void RenderBatcher::Flush()
     uint32_t totalDrawCalls = 0;
     uint32_t totalTriangles = 0;
     uint32_t totalVertices = 0;
+    uint32_t shaderBinds = 0;
+    uint32_t materialBinds = 0;
+    uint32_t blendChanges = 0;
 
-    for (const auto &cmd : m_DrawCommands)
+    // Binds the program and uploads the material only when either actually changes
+    auto bindMaterial = [&](Shader *shader, Material *material)
     {
+        if (shader == boundShader && material == appliedMaterial)
+            return;
+        if (shader != boundShader)
+        {
+            shader->Bind();
+            ShaderLibrary::SetViewProjection(shader, m_ViewProjection);
+            boundShader = shader;
+            shaderBinds++;
+        }
+        material->ApplyUniforms(shader);
+        appliedMaterial = material;
+        materialBinds++;
+    };
+
+    size_t i = 0;
+    while (i < entries.size())
+    {
+        const BatchDrawCommand &cmd = m_DrawCommands[entries[i].Payload];
+
         if (cmd.blendMode != lastBlendMode)
         {
             RenderCommand::SetBlendMode(cmd.blendMode);
             lastBlendMode = cmd.blendMode;
+            blendChanges++;
         }
 
-        if (!lastMaterial || cmd.material != lastMaterial)
+        if (cmd.instanceIndex < 0)
         {
-            cmd.material->GetShader()->Bind();
-            cmd.material->ApplyUniforms();
-            ShaderLibrary::SetViewProjection(cmd.material->GetShader().get(), m_ViewProjection);
-            lastMaterial = cmd.material;
+            bindMaterial(cmd.material->GetShader().get(), cmd.material.get());
+            // Set transform uniform
+            ShaderLibrary::SetTransform(cmd.material->GetShader().get(), cmd.transform);
+            cmd.vertexArray->Bind();
+            RenderCommand::DrawIndexed(cmd.vertexArray->GetRendererID(), cmd.indexCount);
+
+            totalDrawCalls++;
+            totalTriangles += cmd.indexCount / 3;
+            totalVertices += cmd.indexCount;
+            ++i;
+            continue;
         }
-        // Set transform uniform
-        ShaderLibrary::SetTransform(cmd.material->GetShader().get(), cmd.transform);
+
+        // Gather the run of instances sharing this mesh, program, blend mode and layer. The color is per instance,
+        // so a different material only ends the run when its other uniforms differ for this program.
+        Shader *instanced = cmd.material->GetShader()->GetInstancedVariant().get();
+        Texture *slots[MaxTextureSlots] = {};
+        uint32_t slotCount = 0;
+        m_InstanceScratch.clear();
+
+        size_t j = i;
+        for (; j < entries.size() && m_InstanceScratch.size() < MaxInstancesPerDraw; ++j)
+        {
+            const BatchDrawCommand &next = m_DrawCommands[entries[j].Payload];
+            if (next.instanceIndex < 0 || next.vertexArray != cmd.vertexArray || next.blendMode != cmd.blendMode ||
+                next.layer != cmd.layer || next.material->GetShader()->GetInstancedVariant().get() != instanced)
+                break;
+            if (next.material != cmd.material && !cmd.material->HasSameUniforms(*next.material, instanced))
+                break;
+
+            BatchInstance instance = m_Instances[next.instanceIndex];
+            if (next.texture)
+            {
+                uint32_t slot = 0;
+                while (slot < slotCount && slots[slot] != next.texture.get())
+                    ++slot;
+                if (slot == slotCount)
+                {
+                    if (slotCount == MaxTextureSlots)
+                        break; // Out of texture units, close this batch
+                    slots[slotCount++] = next.texture.get();
+                }
+                instance.texSlot = static_cast<float>(slot);
+            }
+            m_InstanceScratch.push_back(instance);
+        }
+
+        bindMaterial(instanced, cmd.material.get());
+        for (uint32_t s = 0; s < slotCount; ++s)
+            slots[s]->Bind(s);
+
+        uint32_t instanceCount = static_cast<uint32_t>(m_InstanceScratch.size());
+        m_InstanceBuffer->SetData(reinterpret_cast<float *>(m_InstanceScratch.data()),
+                                  instanceCount * sizeof(BatchInstance));
         cmd.vertexArray->Bind();
-        RenderCommand::DrawIndexed(cmd.vertexArray->GetRendererID(), cmd.indexCount);
+        RenderCommand::DrawIndexedInstanced(cmd.vertexArray->GetRendererID(), cmd.indexCount, instanceCount);
 
         totalDrawCalls++;
-        totalTriangles += cmd.indexCount / 3;
-        totalVertices += cmd.indexCount;
+        totalTriangles += (cmd.indexCount / 3) * instanceCount;
+        totalVertices += cmd.indexCount * instanceCount;
+        i = j;
     }
 
     // Reset to default
     RenderCommand::SetBlendMode(0);
     m_DrawCommands.clear();
+    m_Instances.clear();
+    m_Queue.Clear();
 
     auto endTime = std::chrono::high_resolution_clock::now();
     float durationMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
@@ -78,13 +225,14 @@ void RenderBatcher::Flush()
     if (auto *profiler = ProfilingLayer::GetInstance())
     {
         profiler->RecordRenderTime(durationMs);
-        for (uint32_t i = 0; i < totalDrawCalls; ++i)
+        for (uint32_t n = 0; n < totalDrawCalls; ++n)
         {
             profiler->RecordDrawCall();
         }
         profiler->RecordTriangle(totalTriangles);
         profiler->RecordVertex(totalVertices);
+        profiler->RecordStateChanges(shaderBinds, materialBinds, blendChanges);
     }
 }
 
-} // namespace TE
\ No newline at end of file
+} // namespace TE
@@ -0,0 +1,76 @@
+#include "Renderer/RenderQueue.hpp"
+#include <cstring>
+#include <utility>
+
+namespace TE
+{
+
+uint64_t RenderSortKey::Make(uint32_t layer, uint32_t blendMode, uint32_t shaderID, uint32_t materialID,
+                             uint32_t meshID, uint32_t textureID, float depth)
+{
+    auto field = [](uint64_t value, uint32_t bits) { return value & ((1ull << bits) - 1ull); };
+
+    uint64_t key = field(layer, LayerBits);
+    key = (key << BlendBits) | field(blendMode, BlendBits);
+    key = (key << ShaderBits) | field(shaderID, ShaderBits);
+    key = (key << MaterialBits) | field(materialID, MaterialBits);
+    key = (key << MeshBits) | field(meshID, MeshBits);
+    key = (key << TextureBits) | field(textureID, TextureBits);
+    key = (key << DepthBits) | field(QuantizeDepth(depth) >> (32 - DepthBits), DepthBits);
+    return key;
+}
+
+uint32_t RenderSortKey::QuantizeDepth(float depth)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    // Flip all bits of negatives and only the sign bit of positives so unsigned order matches float order
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+void RenderQueue::Sort()
+{
+    const size_t count = m_Entries.size();
+    if (count < 2)
+        return;
+
+    // One pass builds all eight byte histograms
+    uint32_t histograms[8][256] = {};
+    for (const RenderQueueEntry &entry : m_Entries)
+    {
+        for (uint32_t pass = 0; pass < 8; ++pass)
+            histograms[pass][(entry.Key >> (pass * 8)) & 0xFF]++;
+    }
+
+    m_Scratch.resize(count);
+    RenderQueueEntry *src = m_Entries.data();
+    RenderQueueEntry *dst = m_Scratch.data();
+
+    for (uint32_t pass = 0; pass < 8; ++pass)
+    {
+        uint32_t *histogram = histograms[pass];
+
+        // Every key shares this byte (typical for layer/blend/depth), nothing to reorder
+        if (histogram[(src[0].Key >> (pass * 8)) & 0xFF] == count)
+            continue;
+
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < 256; ++bucket)
+        {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            dst[histogram[(src[i].Key >> (pass * 8)) & 0xFF]++] = src[i];
+
+        std::swap(src, dst);
+    }
+
+    // After an odd number of scatters the sorted data lives in the scratch buffer
+    if (src != m_Entries.data())
+        m_Entries.swap(m_Scratch);
+}
+
+} // namespace TE
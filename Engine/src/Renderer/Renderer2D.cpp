@@ -6,6 +6,9 @@
 #include "Renderer/VertexArray.hpp"
 #include "Renderer/VertexBuffer.hpp"
 #include "Utils/MathUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace TE
@@ -26,6 +29,46 @@ Renderer2D::Renderer2D()
     vbo->Bind();
     m_UnitQuadVAO->AddVertexBuffer(vbo);
     m_UnitQuadVAO->SetIndexBuffer(ibo);
+
+    m_Batcher.Init(m_UnitQuadVAO);
+
+    // Cached unit meshes: circles and triangles are instanced transforms of these, never per-call geometry
+    const int segments = 32;
+    std::vector<float> circleVertices = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i <= segments; ++i)
+    {
+        float angle = 2.0f * 3.14159265f * i / segments;
+        circleVertices.push_back(std::cos(angle) * 0.5f);
+        circleVertices.push_back(std::sin(angle) * 0.5f);
+        circleVertices.push_back(0.0f);
+    }
+    std::vector<uint32_t> circleIndices;
+    for (int i = 1; i <= segments; ++i)
+    {
+        circleIndices.push_back(0);
+        circleIndices.push_back(i);
+        circleIndices.push_back(i + 1);
+    }
+    m_UnitCircleVAO = std::shared_ptr<VertexArray>(VertexArray::Create());
+    auto circleVbo = VertexBuffer::Create(circleVertices.data(), (uint32_t)(circleVertices.size() * sizeof(float)));
+    auto circleIbo = IndexBuffer::Create(circleIndices.data(), (uint32_t)circleIndices.size());
+    m_UnitCircleVAO->Bind();
+    circleVbo->Bind();
+    m_UnitCircleVAO->AddVertexBuffer(circleVbo);
+    m_UnitCircleVAO->SetIndexBuffer(circleIbo);
+    m_CircleMesh = m_Batcher.RegisterMesh(m_UnitCircleVAO, (uint32_t)circleIndices.size());
+
+    // Right triangle (0,0) (1,0) (0,1); any triangle is an affine transform of it
+    float triangleVertices[] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    uint32_t triangleIndices[] = {0, 1, 2};
+    m_UnitTriangleVAO = std::shared_ptr<VertexArray>(VertexArray::Create());
+    auto triangleVbo = VertexBuffer::Create(triangleVertices, sizeof(triangleVertices));
+    auto triangleIbo = IndexBuffer::Create(triangleIndices, 3);
+    m_UnitTriangleVAO->Bind();
+    triangleVbo->Bind();
+    m_UnitTriangleVAO->AddVertexBuffer(triangleVbo);
+    m_UnitTriangleVAO->SetIndexBuffer(triangleIbo);
+    m_TriangleMesh = m_Batcher.RegisterMesh(m_UnitTriangleVAO, 3);
 }
 Renderer2D::~Renderer2D() {}
 
@@ -33,6 +76,9 @@ void Renderer2D::BeginFrame(const TE::TEMatrix4 &viewProjection)
 {
     m_Batcher.SetViewProjection(reinterpret_cast<const glm::mat4 &>(viewProjection));
     m_Batcher.Begin();
+
+    m_LightMaterialsUsed = 0;
+    m_LightMaterialLookup.clear();
 }
 
 void Renderer2D::Submit(const std::shared_ptr<VertexArray> &vao, const std::shared_ptr<Material> &material,
@@ -83,102 +129,126 @@ void Renderer2D::SubmitQuad(const TE::TEMatrix4 &transform, const std::shared_pt
         material->SetUniform("u_AmbientSky", reinterpret_cast<const glm::vec4 &>(m_AmbientSky.GetValue()));
         material->SetUniform("u_AmbientGround", reinterpret_cast<const glm::vec4 &>(m_AmbientGround.GetValue()));
     }
-    m_Batcher.Submit(m_UnitQuadVAO, material, reinterpret_cast<const glm::mat4 &>(transform), 6, blendMode);
+    m_Batcher.SubmitQuad(material, reinterpret_cast<const glm::mat4 &>(transform),
+                         reinterpret_cast<const glm::vec4 &>(material->GetColor().GetValue()), blendMode);
+}
+
+void Renderer2D::SubmitQuad(const TE::TEMatrix4 &transform, const std::shared_ptr<Material> &material,
+                            const std::shared_ptr<Texture> &texture, const TEVector4 &uvRect, int blendMode)
+{
+    m_Batcher.SubmitQuad(material, reinterpret_cast<const glm::mat4 &>(transform),
+                         reinterpret_cast<const glm::vec4 &>(material->GetColor().GetValue()), blendMode, texture,
+                         reinterpret_cast<const glm::vec4 &>(uvRect));
 }
 
 void Renderer2D::SubmitTriangle(const TEVector2 &p1, const TEVector2 &p2, const TEVector2 &p3,
                                 const std::shared_ptr<Material> &material)
 {
-    float vertices[] = {p1.x, p1.y, 0.0f, p2.x, p2.y, 0.0f, p3.x, p3.y, 0.0f};
-    uint32_t indices[] = {0, 1, 2};
-    auto vao = std::shared_ptr<VertexArray>(VertexArray::Create());
-    auto vbo = VertexBuffer::Create(vertices, sizeof(vertices));
-    auto ibo = IndexBuffer::Create(indices, 3);
-    vao->Bind();
-    vbo->Bind();
-    vao->AddVertexBuffer(vbo);
-    vao->SetIndexBuffer(ibo);
+    // Map the unit triangle onto p1, p2, p3: columns are the two edges and the origin
+    glm::mat4 transform(1.0f);
+    transform[0] = glm::vec4(p2.x - p1.x, p2.y - p1.y, 0.0f, 0.0f);
+    transform[1] = glm::vec4(p3.x - p1.x, p3.y - p1.y, 0.0f, 0.0f);
+    transform[3] = glm::vec4(p1.x, p1.y, 0.0f, 1.0f);
+
     material->SetUniform("u_AmbientIntensity", m_AmbientIntensity);
     material->SetUniform("u_AmbientSky", m_AmbientSky);
     material->SetUniform("u_AmbientGround", m_AmbientGround);
-    m_Batcher.Submit(vao, material, glm::mat4(1.0f), 3);
+    m_Batcher.SubmitInstance(m_TriangleMesh, material, transform,
+                             reinterpret_cast<const glm::vec4 &>(material->GetColor().GetValue()));
 }
 
 void Renderer2D::SubmitCircle(const TEVector2 &center, float radius, const std::shared_ptr<Material> &material)
 {
-    const int segments = 32;
-    std::vector<float> vertices;
-    vertices.push_back(center.x);
-    vertices.push_back(center.y);
-    vertices.push_back(0.0f);
-    for (int i = 0; i <= segments; ++i)
-    {
-        float angle = 2.0f * 3.14159265f * i / segments;
-        vertices.push_back(center.x + std::cos(angle) * radius);
-        vertices.push_back(center.y + std::sin(angle) * radius);
-        vertices.push_back(0.0f);
-    }
-    std::vector<uint32_t> indices;
-    for (int i = 1; i <= segments; ++i)
-    {
-        indices.push_back(0);
-        indices.push_back(i);
-        indices.push_back(i + 1);
-    }
-    auto vao = std::shared_ptr<VertexArray>(VertexArray::Create());
-    auto vbo = VertexBuffer::Create(vertices.data(), (uint32_t)(vertices.size() * sizeof(float)));
-    auto ibo = IndexBuffer::Create(indices.data(), (uint32_t)indices.size());
-    vao->Bind();
-    vbo->Bind();
-    vao->AddVertexBuffer(vbo);
-    vao->SetIndexBuffer(ibo);
+    // Unit circle has radius 0.5
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(center.x, center.y, 0.0f)) *
+                          glm::scale(glm::mat4(1.0f), glm::vec3(radius * 2.0f, radius * 2.0f, 1.0f));
+
     material->SetUniform("u_AmbientIntensity", m_AmbientIntensity);
     material->SetUniform("u_AmbientSky", m_AmbientSky);
     material->SetUniform("u_AmbientGround", m_AmbientGround);
-    m_Batcher.Submit(vao, material, glm::mat4(1.0f), (uint32_t)indices.size());
+    m_Batcher.SubmitInstance(m_CircleMesh, material, transform,
+                             reinterpret_cast<const glm::vec4 &>(material->GetColor().GetValue()));
 }
 
-void Renderer2D::SubmitLight(const LightComponent &light, const TEVector2 &position, float rotationRadians)
+bool Renderer2D::LightMaterialKey::operator==(const LightMaterialKey &other) const
 {
-    static std::shared_ptr<Shader> lightShader = nullptr;
-    if (!lightShader)
-        lightShader = ShaderLibrary::CreateLight2DShader();
+    return std::memcmp(this, &other, sizeof(LightMaterialKey)) == 0;
+}
 
-    auto lightMaterial = std::make_shared<Material>(lightShader);
+size_t Renderer2D::LightMaterialKeyHash::operator()(const LightMaterialKey &key) const
+{
+    // FNV-1a over the raw bytes; the key is all 4-byte fields, so there is no padding
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&key);
+    size_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < sizeof(LightMaterialKey); ++i)
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    return hash;
+}
 
-    lightMaterial->SetColor(light.Color);
-    lightMaterial->SetUniform("u_Intensity", light.Intensity);
-    lightMaterial->SetUniform("u_FalloffExponent", light.FalloffExponent);
-    lightMaterial->SetUniform("u_LightType", (int)light.Type);
+const std::shared_ptr<Material> &Renderer2D::GetLightMaterial(const LightMaterialKey &key)
+{
+    auto it = m_LightMaterialLookup.find(key);
+    if (it != m_LightMaterialLookup.end())
+        return m_LightMaterials[it->second];
+
+    size_t index = m_LightMaterialsUsed++;
+    if (index == m_LightMaterials.size())
+        m_LightMaterials.push_back(std::make_shared<Material>(m_Light2DMaterial->GetShader()));
+    m_LightMaterialLookup.emplace(key, index);
+
+    // Every light type writes the full set; the shader only reads the ones its type uses
+    Material &material = *m_LightMaterials[index];
+    material.SetColor(TEColor(key.Color[0], key.Color[1], key.Color[2], key.Color[3]));
+    material.SetUniform("u_Intensity", key.Intensity);
+    material.SetUniform("u_FalloffExponent", key.FalloffExponent);
+    material.SetUniform("u_LightType", key.Type);
+    material.SetUniform("u_Direction", glm::vec2(key.Direction[0], key.Direction[1]));
+    material.SetUniform("u_InnerAngle", key.InnerAngle);
+    material.SetUniform("u_OuterAngle", key.OuterAngle);
+    material.SetUniform("u_LineLength", key.LineLength);
+    material.SetUniform("u_Radius", key.Radius);
+    return m_LightMaterials[index];
+}
+
+void Renderer2D::SubmitLight(const LightComponent &light, const TEVector2 &position, float rotationRadians)
+{
+    LightMaterialKey key;
+    key.Type = (int)light.Type;
+    key.Color[0] = light.Color.r;
+    key.Color[1] = light.Color.g;
+    key.Color[2] = light.Color.b;
+    key.Color[3] = light.Color.a;
+    key.Intensity = light.Intensity;
+    key.FalloffExponent = light.FalloffExponent;
 
     if (light.Type == TELightType::Point)
     {
         glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(position.x, position.y, 0.0f)) *
                               glm::scale(glm::mat4(1.0f), glm::vec3(light.Radius * 2.0f, light.Radius * 2.0f, 1.0f));
-        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), lightMaterial, 1);
+        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), GetLightMaterial(key), 1);
     }
     else if (light.Type == TELightType::Spot)
     {
         float baseAngle = atan2(light.Direction.y, light.Direction.x);
         float finalAngle = baseAngle + rotationRadians;
-        glm::vec2 finalDirection = {cos(finalAngle), sin(finalAngle)};
 
-        lightMaterial->SetUniform("u_Direction", finalDirection);
-        lightMaterial->SetUniform("u_InnerAngle", light.InnerAngle);
-        lightMaterial->SetUniform("u_OuterAngle", light.OuterAngle);
+        key.Direction[0] = cos(finalAngle);
+        key.Direction[1] = sin(finalAngle);
+        key.InnerAngle = light.InnerAngle;
+        key.OuterAngle = light.OuterAngle;
 
         glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(position.x, position.y, 0.0f)) *
                               glm::rotate(glm::mat4(1.0f), rotationRadians, glm::vec3(0.0f, 0.0f, 1.0f)) *
                               glm::scale(glm::mat4(1.0f), glm::vec3(light.Radius * 2.0f, light.Radius * 2.0f, 1.0f));
-        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), lightMaterial, 1);
+        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), GetLightMaterial(key), 1);
     }
     else if (light.Type == TELightType::Line)
     {
         float length = sqrt(light.LineOffset.x * light.LineOffset.x + light.LineOffset.y * light.LineOffset.y);
         float angle = atan2(light.LineOffset.y, light.LineOffset.x);
 
-        lightMaterial->SetUniform("u_LineLength", length);
-        lightMaterial->SetUniform("u_Radius", light.Radius);
+        key.LineLength = length;
+        key.Radius = light.Radius;
 
         // Translate to middle of line
         glm::mat4 transform =
@@ -186,71 +256,138 @@ void Renderer2D::SubmitLight(const LightComponent &light, const TEVector2 &posit
                                                       position.y + light.LineOffset.y * 0.5f, 0.0f)) *
             glm::rotate(glm::mat4(1.0f), angle, glm::vec3(0.0f, 0.0f, 1.0f)) *
             glm::scale(glm::mat4(1.0f), glm::vec3(length + light.Radius * 2.0f, light.Radius * 2.0f, 1.0f));
-        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), lightMaterial, 1);
+        SubmitQuad(reinterpret_cast<const TEMatrix4 &>(transform), GetLightMaterial(key), 1);
     }
 }
 
-void Renderer2D::SubmitShadow(const TEVector2 &lightPos, float lightRadius, const std::vector<TEVector2> &vertices)
+void Renderer2D::BuildShadowHull(const std::vector<TEVector2> &vertices, ShadowOccluder &outOccluder)
 {
-    if (vertices.size() < 2)
-        return;
+    // Andrew's monotone chain, counter-clockwise without collinear points
+    std::vector<TEVector2> &hull = outOccluder.Hull;
+    hull.clear();
 
-    // Find the two silhouette vertices: the ones that form the widest angle from the light.
-    glm::vec2 lp(lightPos.x, lightPos.y);
+    std::vector<TEVector2> sorted(vertices);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const TEVector2 &a, const TEVector2 &b) { return a.x < b.x || (a.x == b.x && a.y < b.y); });
 
-    // Compute angles from light to each vertex
-    std::vector<float> angles;
-    angles.reserve(vertices.size());
-    for (const auto &v : vertices)
-    {
-        glm::vec2 dir = glm::vec2(v.x, v.y) - lp;
-        angles.push_back(atan2(dir.y, dir.x));
-    }
+    auto cross = [](const TEVector2 &o, const TEVector2 &a, const TEVector2 &b)
+    { return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x); };
 
-    // Find the two vertices that form the widest angular spread from the light.
-    int bestA = 0, bestB = 1;
-    float maxSpread = -1.0f;
-    for (size_t i = 0; i < vertices.size(); i++)
+    if (sorted.size() >= 3)
     {
-        for (size_t j = i + 1; j < vertices.size(); j++)
+        hull.resize(sorted.size() * 2);
+        size_t k = 0;
+        for (size_t i = 0; i < sorted.size(); ++i)
         {
-            float diff = angles[j] - angles[i];
-            while (diff > 3.14159265f)
-                diff -= 2.0f * 3.14159265f;
-            while (diff < -3.14159265f)
-                diff += 2.0f * 3.14159265f;
-            float absDiff = std::abs(diff);
-
-            if (absDiff > maxSpread)
-            {
-                maxSpread = absDiff;
-                bestA = (int)i;
-                bestB = (int)j;
-            }
+            while (k >= 2 && cross(hull[k - 2], hull[k - 1], sorted[i]) <= 0.0f)
+                k--;
+            hull[k++] = sorted[i];
         }
+        for (size_t i = sorted.size() - 1, lower = k + 1; i > 0; --i)
+        {
+            while (k >= lower && cross(hull[k - 2], hull[k - 1], sorted[i - 1]) <= 0.0f)
+                k--;
+            hull[k++] = sorted[i - 1];
+        }
+        hull.resize(k - 1); // Last point repeats the first
+    }
+    else
+    {
+        hull = sorted;
     }
 
-    // Project ray from light through each silhouette vertex
-    float projDist = lightRadius * 3.0f;
+    // Bounding circle for culling
+    TEVector2 center(0.0f, 0.0f);
+    for (const auto &v : hull)
+        center += v;
+    if (!hull.empty())
+        center = center * (1.0f / (float)hull.size());
+    float radiusSq = 0.0f;
+    for (const auto &v : hull)
+        radiusSq = std::max(radiusSq, (v - center).LengthSquared());
+
+    outOccluder.Center = center;
+    outOccluder.Radius = std::sqrt(radiusSq);
+}
 
-    glm::vec2 cA(vertices[bestA].x, vertices[bestA].y);
-    glm::vec2 cB(vertices[bestB].x, vertices[bestB].y);
+void Renderer2D::SubmitShadows(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder *occluders,
+                               size_t count)
+{
+    for (size_t o = 0; o < count; ++o)
+        SubmitShadowVolume(lightPos, lightRadius, occluders[o]);
+}
 
-    glm::vec2 dirA = glm::normalize(cA - lp);
-    glm::vec2 dirB = glm::normalize(cB - lp);
+void Renderer2D::SubmitShadows(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder *occluders,
+                               const uint32_t *indices, size_t count)
+{
+    for (size_t o = 0; o < count; ++o)
+        SubmitShadowVolume(lightPos, lightRadius, occluders[indices[o]]);
+}
 
-    glm::vec2 farA = cA + dirA * projDist;
-    glm::vec2 farB = cB + dirB * projDist;
+void Renderer2D::SubmitShadowVolume(const TEVector2 &lightPos, float lightRadius, const ShadowOccluder &occluder)
+{
+    if (!m_ShadowMaterial)
+    {
+        m_ShadowMaterial = std::make_shared<Material>(ShaderLibrary::CreateColorShader());
+        m_ShadowMaterial->SetColor(TEColor(0.0f, 0.0f, 0.0f, 1.0f));
+    }
 
-    static std::shared_ptr<Shader> shadowShader = nullptr;
-    if (!shadowShader)
-        shadowShader = ShaderLibrary::CreateColorShader();
+    const std::vector<TEVector2> &hull = occluder.Hull;
+    const size_t n = hull.size();
+    if (n < 2)
+        return;
 
-    auto shadowMat = std::make_shared<Material>(shadowShader);
-    shadowMat->SetColor(TEColor(0.0f, 0.0f, 0.0f, 1.0f));
+    // Bounding circle outside the light's reach
+    float maxDist = lightRadius + occluder.Radius;
+    if ((occluder.Center - lightPos).LengthSquared() > maxDist * maxDist)
+        return;
+
+    // An edge faces the light when the light is on its outer (right) side of the CCW hull.
+    // The silhouette vertices are where facing flips between consecutive edges: O(n), no trig.
+    auto facesLight = [&](size_t i)
+    {
+        const TEVector2 &a = hull[i];
+        const TEVector2 &b = hull[(i + 1) % n];
+        return (b.x - a.x) * (lightPos.y - a.y) - (b.y - a.y) * (lightPos.x - a.x) < 0.0f;
+    };
+
+    int enter = -1; // First vertex of the lit chain
+    int leave = -1; // Last vertex of the lit chain
+    bool prevFacing = facesLight(n - 1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        bool facing = facesLight(i);
+        if (facing && !prevFacing)
+            enter = (int)i;
+        else if (!facing && prevFacing)
+            leave = (int)i;
+        prevFacing = facing;
+    }
 
-    SubmitTriangle(TEVector2(cA.x, cA.y), TEVector2(cB.x, cB.y), TEVector2(farB.x, farB.y), shadowMat);
-    SubmitTriangle(TEVector2(cA.x, cA.y), TEVector2(farB.x, farB.y), TEVector2(farA.x, farA.y), shadowMat);
+    // Light inside the hull (nothing faces it) or a degenerate outline
+    if (enter < 0 || leave < 0)
+        return;
+
+    // Project ray from light through each silhouette vertex
+    const float projDist = lightRadius * 3.0f;
+    const TEVector2 &cA = hull[enter];
+    const TEVector2 &cB = hull[leave];
+    TEVector2 farA = cA + (cA - lightPos).Normalized() * projDist;
+    TEVector2 farB = cB + (cB - lightPos).Normalized() * projDist;
+
+    // Both triangles go through the cached unit triangle into the frame's instance stream
+    SubmitTriangle(cA, cB, farB, m_ShadowMaterial);
+    SubmitTriangle(cA, farB, farA, m_ShadowMaterial);
+}
+
+void Renderer2D::SubmitShadow(const TEVector2 &lightPos, float lightRadius, const std::vector<TEVector2> &vertices)
+{
+    if (vertices.size() < 2)
+        return;
+
+    ShadowOccluder occluder;
+    BuildShadowHull(vertices, occluder);
+    SubmitShadows(lightPos, lightRadius, &occluder, 1);
 }
 
 void Renderer2D::SetAmbientLight(const TEColor &color, float intensity)
@@ -275,9 +412,14 @@ void Renderer2D::SetAmbientGradient(const TEColor &sky, const TEColor &horizon,
 void Renderer2D::SubmitRectOutline(const TEVector2 &position, const TEVector2 &size, float thickness,
                                    const TEColor &color)
 {
-    auto debugMaterial = std::make_shared<Material>(ShaderLibrary::CreateColorShader());
+    // Color is captured per quad by the batcher, so one shared material is enough
+    static std::shared_ptr<Material> debugMaterial = nullptr;
+    if (!debugMaterial)
+    {
+        debugMaterial = std::make_shared<Material>(ShaderLibrary::CreateColorShader());
+        debugMaterial->SetUniform("u_IsUnlit", 1.0f);
+    }
     debugMaterial->SetColor(color);
-    debugMaterial->SetUniform("u_IsUnlit", 1.0f);
 
     // position is center, size is total width/height
     // Top
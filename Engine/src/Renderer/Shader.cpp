@@ -13,9 +13,14 @@
 #ifdef TE_SUPPORT_VULKAN
 #include "Renderer/Vulkan/VulkanShader.hpp"
 #endif
+#include <atomic>
 
 namespace TE
 {
+static std::atomic<uint32_t> s_NextShaderID{1};
+
+Shader::Shader() : m_ShaderID(s_NextShaderID.fetch_add(1, std::memory_order_relaxed)) {}
+
 Shader *Shader::Create(const std::string &vertexSrc, const std::string &fragmentSrc)
 {
     switch (RendererContext::GetAPI())
@@ -43,4 +48,64 @@ Shader *Shader::Create(const std::string &vertexSrc, const std::string &fragment
         return nullptr;
     }
 }
+
+UniformHandle Shader::GetUniformHandle(const std::string &name)
+{
+    auto it = m_FallbackUniformIndices.find(name);
+    if (it != m_FallbackUniformIndices.end())
+        return {it->second};
+
+    int32_t index = static_cast<int32_t>(m_FallbackUniformNames.size());
+    m_FallbackUniformNames.push_back(name);
+    m_FallbackUniformIndices[name] = index;
+    return {index};
+}
+
+void Shader::SetUniformMat4(UniformHandle handle, const glm::mat4 &value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniformMat4(m_FallbackUniformNames[handle.Location], value);
+}
+
+void Shader::SetUniform4f(UniformHandle handle, const glm::vec4 &value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniform4f(m_FallbackUniformNames[handle.Location], value);
+}
+
+void Shader::SetUniform3f(UniformHandle handle, const glm::vec3 &value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniform3f(m_FallbackUniformNames[handle.Location], value);
+}
+
+void Shader::SetUniform2f(UniformHandle handle, const glm::vec2 &value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniform2f(m_FallbackUniformNames[handle.Location], value);
+}
+
+void Shader::SetUniform1f(UniformHandle handle, float value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniform1f(m_FallbackUniformNames[handle.Location], value);
+}
+
+void Shader::SetUniform1i(UniformHandle handle, int value)
+{
+    if (handle.IsValid() && handle.Location < (int32_t)m_FallbackUniformNames.size())
+        SetUniform1i(m_FallbackUniformNames[handle.Location], value);
+}
+
+const Shader::CommonUniformHandles &Shader::GetCommonHandles()
+{
+    if (!m_CommonHandlesResolved)
+    {
+        m_CommonHandles.Transform = GetUniformHandle("u_Transform");
+        m_CommonHandles.ViewProjection = GetUniformHandle("u_ViewProjection");
+        m_CommonHandles.Color = GetUniformHandle("u_Color");
+        m_CommonHandlesResolved = true;
+    }
+    return m_CommonHandles;
+}
 } // namespace TE
@@ -35,11 +35,35 @@ std::shared_ptr<Shader> ShaderLibrary::CreateColorShader()
 {
     if (RendererContext::GetAPI() == GraphicsAPI::OpenGL)
     {
-        return OpenGLShaderLibrary::CreateOpenGLColorShader();
+        std::shared_ptr<Shader> shader = OpenGLShaderLibrary::CreateOpenGLColorShader();
+        shader->SetInstancedVariant(CreateInstancedQuadShader());
+        return shader;
     }
     return nullptr;
 }
 
+std::shared_ptr<Shader> ShaderLibrary::CreateInstancedQuadShader()
+{
+    // Shared by every color shader, so quads from different materials can still land in the same program
+    auto it = s_ShaderCache.find("InstancedQuad");
+    if (it != s_ShaderCache.end())
+        return it->second;
+
+    auto shader =
+        std::shared_ptr<Shader>(Shader::Create(GetInstancedQuadVertexShader(), GetInstancedQuadFragmentShader()));
+    if (!shader)
+        return nullptr;
+
+    // Sampler array units never change, bind them once
+    shader->Bind();
+    for (int i = 0; i < 8; ++i)
+        shader->SetUniform1i("u_Textures[" + std::to_string(i) + "]", i);
+    shader->Unbind();
+
+    s_ShaderCache["InstancedQuad"] = shader;
+    return shader;
+}
+
 std::shared_ptr<Shader> ShaderLibrary::CreateStandardShader()
 {
     if (RendererContext::GetAPI() == GraphicsAPI::OpenGL)
@@ -120,28 +144,26 @@ void ShaderLibrary::SetColor(Shader *shader, const TEColor &color)
 
 void ShaderLibrary::SetColor(Shader *shader, const glm::vec4 &color)
 {
-    if (RendererContext::GetAPI() == GraphicsAPI::OpenGL)
+    if (shader && RendererContext::GetAPI() == GraphicsAPI::OpenGL)
     {
-        OpenGLShader *glShader = static_cast<OpenGLShader *>(shader);
-        OpenGLShaderLibrary::SetUniform4f(glShader, "u_Color", color);
+        // Hot path: resolved once per shader, then uploaded by location
+        shader->SetUniform4f(shader->GetCommonHandles().Color, color);
     }
 }
 
 void ShaderLibrary::SetTransform(Shader *shader, const glm::mat4 &transform)
 {
-    if (RendererContext::GetAPI() == GraphicsAPI::OpenGL)
+    if (shader && RendererContext::GetAPI() == GraphicsAPI::OpenGL)
     {
-        OpenGLShader *glShader = static_cast<OpenGLShader *>(shader);
-        OpenGLShaderLibrary::SetUniformMat4(glShader, "u_Transform", transform);
+        shader->SetUniformMat4(shader->GetCommonHandles().Transform, transform);
     }
 }
 
 void ShaderLibrary::SetViewProjection(Shader *shader, const glm::mat4 &viewProjection)
 {
-    if (RendererContext::GetAPI() == GraphicsAPI::OpenGL)
+    if (shader && RendererContext::GetAPI() == GraphicsAPI::OpenGL)
     {
-        OpenGLShader *glShader = static_cast<OpenGLShader *>(shader);
-        OpenGLShaderLibrary::SetUniformMat4(glShader, "u_ViewProjection", viewProjection);
+        shader->SetUniformMat4(shader->GetCommonHandles().ViewProjection, viewProjection);
     }
 }
 
@@ -1014,4 +1036,59 @@ std::string ShaderLibrary::GetLightBlendFragmentShader()
         )";
 }
 
+std::string ShaderLibrary::GetInstancedQuadVertexShader()
+{
+    return R"(
+            #version 330 core
+            layout(location = 0) in vec3 a_Position;
+            layout(location = 1) in mat4 a_Transform; // locations 1-4
+            layout(location = 5) in vec4 a_Color;
+            layout(location = 6) in vec4 a_UVRect;    // xy = offset, zw = size
+            layout(location = 7) in float a_TexSlot;  // < 0 = untextured
+
+            uniform mat4 u_ViewProjection;
+
+            out vec4 v_Color;
+            out vec2 v_TexCoord;
+            flat out int v_TexSlot;
+
+            void main() {
+                v_Color = a_Color;
+                v_TexCoord = a_UVRect.xy + (a_Position.xy + 0.5) * a_UVRect.zw;
+                v_TexSlot = int(a_TexSlot);
+                gl_Position = u_ViewProjection * a_Transform * vec4(a_Position, 1.0);
+            }
+        )";
+}
+
+std::string ShaderLibrary::GetInstancedQuadFragmentShader()
+{
+    return R"(
+            #version 330 core
+            in vec4 v_Color;
+            in vec2 v_TexCoord;
+            flat in int v_TexSlot;
+
+            uniform sampler2D u_Textures[8];
+
+            out vec4 FragColor;
+
+            void main() {
+                vec4 texColor = vec4(1.0);
+                // GLSL 330 only allows constant sampler indices
+                switch (v_TexSlot) {
+                    case 0: texColor = texture(u_Textures[0], v_TexCoord); break;
+                    case 1: texColor = texture(u_Textures[1], v_TexCoord); break;
+                    case 2: texColor = texture(u_Textures[2], v_TexCoord); break;
+                    case 3: texColor = texture(u_Textures[3], v_TexCoord); break;
+                    case 4: texColor = texture(u_Textures[4], v_TexCoord); break;
+                    case 5: texColor = texture(u_Textures[5], v_TexCoord); break;
+                    case 6: texColor = texture(u_Textures[6], v_TexCoord); break;
+                    case 7: texColor = texture(u_Textures[7], v_TexCoord); break;
+                }
+                FragColor = texColor * v_Color;
+            }
+        )";
+}
+
 } // namespace TE
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "Renderer/ShadowOccluderGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace TE
+{
+
+void ShadowOccluderGrid::Build(const ShadowOccluder *occluders, size_t count, float cellSize)
+{
+    m_CellsX = m_CellsY = 0;
+    m_CellStart.clear();
+    m_CellEntries.clear();
+    m_Ranges.resize(count);
+    m_Stamps.assign(count, 0);
+    m_QueryStamp = 0;
+    if (count == 0)
+        return;
+
+    float minX = occluders[0].Center.x, minY = occluders[0].Center.y;
+    float maxX = minX, maxY = minY;
+    float radiusSum = 0.0f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ShadowOccluder &occ = occluders[i];
+        minX = std::min(minX, occ.Center.x - occ.Radius);
+        minY = std::min(minY, occ.Center.y - occ.Radius);
+        maxX = std::max(maxX, occ.Center.x + occ.Radius);
+        maxY = std::max(maxY, occ.Center.y + occ.Radius);
+        radiusSum += occ.Radius;
+    }
+
+    // Cells about two occluders wide keep most occluders in one to four cells
+    if (cellSize <= 0.0f)
+        cellSize = std::max(4.0f * radiusSum / (float)count, 1e-3f);
+
+    // Coarsen the grid when the scene is too sparse for the requested size
+    float extent = std::max(maxX - minX, maxY - minY);
+    cellSize = std::max(cellSize, extent / (float)MaxCellsPerAxis);
+
+    m_Origin = TEVector2(minX, minY);
+    m_InvCellSize = 1.0f / cellSize;
+    m_CellsX = std::min((int32_t)((maxX - minX) * m_InvCellSize) + 1, (int32_t)MaxCellsPerAxis);
+    m_CellsY = std::min((int32_t)((maxY - minY) * m_InvCellSize) + 1, (int32_t)MaxCellsPerAxis);
+
+    // Counting pass, then prefix sum, then fill: every occluder lands in each cell its bounds touch
+    m_CellStart.assign((size_t)m_CellsX * m_CellsY + 1, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_Ranges[i] = GetCellRange(occluders[i].Center, occluders[i].Radius);
+        const CellRange &r = m_Ranges[i];
+        for (int32_t y = r.MinY; y <= r.MaxY; ++y)
+            for (int32_t x = r.MinX; x <= r.MaxX; ++x)
+                m_CellStart[(size_t)y * m_CellsX + x + 1]++;
+    }
+    for (size_t c = 1; c < m_CellStart.size(); ++c)
+        m_CellStart[c] += m_CellStart[c - 1];
+
+    m_CellEntries.resize(m_CellStart.back());
+    m_CellCursor.assign(m_CellStart.begin(), m_CellStart.end() - 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const CellRange &r = m_Ranges[i];
+        for (int32_t y = r.MinY; y <= r.MaxY; ++y)
+            for (int32_t x = r.MinX; x <= r.MaxX; ++x)
+                m_CellEntries[m_CellCursor[(size_t)y * m_CellsX + x]++] = (uint32_t)i;
+    }
+}
+
+ShadowOccluderGrid::CellRange ShadowOccluderGrid::GetCellRange(const TEVector2 &center, float radius) const
+{
+    auto cell = [](float v, int32_t cells)
+    {
+        // Clamp in float first so huge radii cannot overflow the integer conversion
+        float clamped = std::min(std::max(std::floor(v), 0.0f), (float)(cells - 1));
+        return (int32_t)clamped;
+    };
+
+    return {cell((center.x - radius - m_Origin.x) * m_InvCellSize, m_CellsX),
+            cell((center.y - radius - m_Origin.y) * m_InvCellSize, m_CellsY),
+            cell((center.x + radius - m_Origin.x) * m_InvCellSize, m_CellsX),
+            cell((center.y + radius - m_Origin.y) * m_InvCellSize, m_CellsY)};
+}
+
+void ShadowOccluderGrid::Query(const TEVector2 &center, float radius, std::vector<uint32_t> &outIndices) const
+{
+    if (m_CellsX == 0)
+        return;
+
+    // Reject queries that miss the populated area entirely
+    float maxX = m_Origin.x + (float)m_CellsX / m_InvCellSize;
+    float maxY = m_Origin.y + (float)m_CellsY / m_InvCellSize;
+    if (center.x + radius < m_Origin.x || center.y + radius < m_Origin.y || center.x - radius > maxX ||
+        center.y - radius > maxY)
+        return;
+
+    if (++m_QueryStamp == 0)
+    {
+        std::fill(m_Stamps.begin(), m_Stamps.end(), 0);
+        m_QueryStamp = 1;
+    }
+
+    CellRange r = GetCellRange(center, radius);
+    for (int32_t y = r.MinY; y <= r.MaxY; ++y)
+    {
+        for (int32_t x = r.MinX; x <= r.MaxX; ++x)
+        {
+            size_t cellIndex = (size_t)y * m_CellsX + x;
+            for (uint32_t e = m_CellStart[cellIndex]; e < m_CellStart[cellIndex + 1]; ++e)
+            {
+                uint32_t index = m_CellEntries[e];
+                if (m_Stamps[index] == m_QueryStamp)
+                    continue;
+                m_Stamps[index] = m_QueryStamp;
+                outIndices.push_back(index);
+            }
+        }
+    }
+}
+
+} // namespace TE
@@ -27,6 +27,11 @@ void VulkanRendererAPI::DrawIndexed(uint32_t vao, uint32_t indexCount)
     // Vulkan draw command: vkCmdDrawIndexed
 }
 
+void VulkanRendererAPI::DrawIndexedInstanced(uint32_t vao, uint32_t indexCount, uint32_t instanceCount)
+{
+    // Vulkan draw command: vkCmdDrawIndexed with instanceCount
+}
+
 void VulkanRendererAPI::SetBlendMode(int blendMode)
 {
     // Vulkan blends are configured in the VkPipelineColorBlendStateCreateInfo
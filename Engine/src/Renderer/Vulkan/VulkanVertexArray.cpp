@@ -19,4 +19,11 @@ void VulkanVertexArray::AddVertexBuffer(VertexBuffer *vertexBuffer) { m_VertexBu
 
 void VulkanVertexArray::SetIndexBuffer(IndexBuffer *indexBuffer) { m_IndexBuffer = indexBuffer; }
 
+void VulkanVertexArray::AddInstanceBuffer(VertexBuffer *vertexBuffer, uint32_t firstLocation,
+                                          const std::vector<uint32_t> &componentCounts)
+{
+    // Instance rate is declared in the pipeline's VkVertexInputBindingDescription (VK_VERTEX_INPUT_RATE_INSTANCE)
+    m_InstanceBuffer = vertexBuffer;
+}
+
 } // namespace TE
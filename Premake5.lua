@@ -442,6 +442,73 @@ project "TimeEditor"
         defines { "TE_DIST", "TE_PACKAGED", "TE_MINIMIZED" }
         optimize "On"
 
+-- ========== Benchmarks Project ==========
+
+-- Headless console app measuring engine hot paths against a null renderer: Benchmarks [--list] [name...]
+project "Benchmarks"
+    location "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+    staticruntime "off"
+
+    -- Next to the editor so it finds the Engine and Velox libraries
+    targetdir ("Bin/" .. outputdir .. "/TimeEditor")
+    objdir ("Bin-Intermediate/" .. outputdir .. "/%{prj.name}")
+
+    files {
+        "Benchmarks/src/**.hpp",
+        "Benchmarks/src/**.cpp"
+    }
+
+    includedirs {
+        "Benchmarks/src",
+        "%{IncludeDir.ImGui}",
+        "%{IncludeDir.Engine}",
+        "%{IncludeDir.Engine_Include}",
+        "%{IncludeDir.Logger}",
+        "%{IncludeDir.GLM}",
+        "%{IncludeDir.Velox}"
+    }
+
+    filter "action:vs*"
+        libdirs {
+            "Vendor/Customizable_Logger/build/lib/%{cfg.buildcfg}"
+        }
+    filter "action:gmake*"
+        libdirs {
+            "Vendor/Customizable_Logger/build/lib"
+        }
+    filter {}
+
+    links {
+        "Engine",
+        "Customizable_Logger",
+        "Velox"
+    }
+
+    dependson { "Engine", "Logger", "Velox" }
+
+    filter "action:vs*"
+        buildoptions { "/utf-8" }
+    filter {}
+
+    filter "system:windows"
+        systemversion "latest"
+        defines { "TE_PLATFORM_WINDOWS" }
+
+    filter "configurations:Debug"
+        defines { "TE_DEBUG", "TE_EDITOR" }
+        symbols "On"
+
+    filter "configurations:Release"
+        defines { "TE_RELEASE", "TE_EDITOR" }
+        optimize "On"
+
+    filter "configurations:Dist"
+        defines { "TE_DIST", "TE_PACKAGED", "TE_MINIMIZED" }
+        optimize "On"
+
 -- ========== Dynamic Plugin Projects Discovery & Generation ==========
 
 group "Plugins"